@@ -25,6 +25,7 @@
 #include "editors/sysloglocator.h"
 #include "editors/abstractsystemlogger.h"
 #include "networkmanager.h"
+#include "diagnostics.h"
 
 #include <iostream>
 #include <QMessageBox>
@@ -70,6 +71,8 @@ void Application::init()
                              mCmdParser.resetView());
     mMainWindow = std::unique_ptr<MainWindow>(new MainWindow());
     mMainWindow->setInitialFiles(mCmdParser.files());
+    if (!mCmdParser.diagnosticsFile().isEmpty())
+        Diagnostics::instance()->start(mCmdParser.diagnosticsFile());
 
     mDistribValidator.start();
     listen();
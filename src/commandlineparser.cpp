@@ -38,6 +38,8 @@ CommandLineParseResult CommandLineParser::parseCommandLine()
     addOption({"reset-settings", "Reset all settings including views to default."});
     addOption({"reset-view", "Reset views and window positions only."});
     addOption({"gams-dir", "Set the GAMS system directory", "path"});
+    addOption({"diagnostics", "Report GUI stalls to the system log and write a Chrome trace of the hot paths to the "
+                              "given file on exit", "trace-file"});
 
     if (!parse(QCoreApplication::arguments()))
         return CommandLineError;
@@ -53,6 +55,8 @@ CommandLineParseResult CommandLineParser::parseCommandLine()
         mResetView = true;
     if (isSet("gams-dir"))
         mGamsDir = this->value("gams-dir");
+    if (isSet("diagnostics"))
+        mDiagnosticsFile = CommonPaths::absolutFilePath(this->value("diagnostics"));
     mFiles = getFileArgs();
 
     return CommandLineOk;
@@ -83,6 +87,11 @@ QString CommandLineParser::gamsDir() const
     return mGamsDir;
 }
 
+QString CommandLineParser::diagnosticsFile() const
+{
+    return mDiagnosticsFile;
+}
+
 inline QStringList CommandLineParser::getFileArgs()
 {
     QStringList absoluteFilePaths;
@@ -43,6 +43,7 @@ public:
     bool resetSettings() const;
     bool resetView() const;
     QString gamsDir() const;
+    QString diagnosticsFile() const;
 
 private:
     inline QStringList getFileArgs();
@@ -53,6 +54,7 @@ private:
     bool mResetSettings = false;
     bool mResetView = false;
     QString mGamsDir = QString();
+    QString mDiagnosticsFile = QString();
 };
 
 } // namespace studio
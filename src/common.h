@@ -113,7 +113,8 @@ enum class EditorType {
     gdx = 7,
     ref = 8,
     opt = 9,
-    gucfg = 10
+    gucfg = 10,
+    placeholder = 11
 };
 Q_ENUM_NS(EditorType)
 
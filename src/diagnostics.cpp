@@ -0,0 +1,212 @@
+/*
+ * This file is part of the GAMS Studio project.
+ *
+ * Copyright (c) 2017-2020 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2020 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "diagnostics.h"
+#include "logger.h"
+#include "editors/abstractsystemlogger.h"
+#include "editors/sysloglocator.h"
+
+#include <QCoreApplication>
+#include <QThread>
+#include <QSaveFile>
+#include <QHash>
+#include <algorithm>
+
+namespace gams {
+namespace studio {
+
+Diagnostics *Diagnostics::mInstance = nullptr;
+QAtomicInt Diagnostics::mActive = 0;
+
+Diagnostics::Diagnostics()
+    : QObject(nullptr)
+{
+    mHeartbeat.setTimerType(Qt::PreciseTimer);
+    mHeartbeat.setInterval(CHeartbeatInterval);
+    connect(&mHeartbeat, &QTimer::timeout, this, &Diagnostics::heartbeat);
+}
+
+Diagnostics *Diagnostics::instance()
+{
+    if (!mInstance) mInstance = new Diagnostics();
+    return mInstance;
+}
+
+void Diagnostics::start(const QString &traceFile)
+{
+    if (isActive()) return;
+    mTraceFile = traceFile;
+    mGuiThread = quintptr(QThread::currentThreadId());
+    {
+        QMutexLocker locker(&mMutex);
+        mScopes.resize(CMaxScopes);
+        mNextScope = 0;
+        mWrapped = false;
+    }
+    mStallCount = 0;
+    mStallTime = 0;
+    mClock.start();
+    mLastBeat = 0;
+    mActive.storeRelease(1);
+    mHeartbeat.start();
+    connect(qApp, &QCoreApplication::aboutToQuit, this, &Diagnostics::stop, Qt::UniqueConnection);
+    SysLogLocator::systemLog()->append(QString("Diagnostics active: GUI stalls above %1 ms are reported, the trace is "
+                                               "written to %2 on exit").arg(CStallThreshold).arg(mTraceFile),
+                                       LogMsgType::Info);
+}
+
+void Diagnostics::stop()
+{
+    if (!isActive()) return;
+    mActive.storeRelease(0);
+    mHeartbeat.stop();
+    DEB() << "Diagnostics: " << mStallCount << " GUI stalls with " << mStallTime / 1000 << " ms in total";
+    if (!mTraceFile.isEmpty() && !writeTrace(mTraceFile))
+        DEB() << "Diagnostics: could not write trace file " << mTraceFile;
+    QMutexLocker locker(&mMutex);
+    mScopes.clear();
+    mScopes.squeeze();
+}
+
+qint64 Diagnostics::elapsed() const
+{
+    return mClock.nsecsElapsed() / 1000;
+}
+
+void Diagnostics::addScope(const char *category, const char *name, qint64 start)
+{
+    qint64 end = elapsed();
+    quintptr thread = quintptr(QThread::currentThreadId());
+    QMutexLocker locker(&mMutex);
+    if (mScopes.isEmpty()) return;
+    mScopes[mNextScope] = Scope {category, name, start, end - start, thread};
+    if (++mNextScope == mScopes.size()) {
+        mNextScope = 0;
+        mWrapped = true;
+    }
+}
+
+QVector<Diagnostics::Scope> Diagnostics::snapshot() const
+{
+    QMutexLocker locker(&mMutex);
+    if (!mWrapped) return mScopes.mid(0, mNextScope);
+    return mScopes.mid(mNextScope) + mScopes.mid(0, mNextScope);
+}
+
+bool Diagnostics::writeTrace(const QString &fileName) const
+{
+    QVector<Scope> scopes = snapshot();
+    QSaveFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text))
+        return false;
+
+    QHash<quintptr, int> threadIds;
+    threadIds.insert(mGuiThread, 1);
+    QByteArray out;
+    out.reserve(1 << 20);
+    out.append("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+               "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"GUI\"}}");
+    for (const Scope &scope : scopes) {
+        int tid = threadIds.value(scope.thread);
+        if (!tid) {
+            tid = threadIds.size() + 1;
+            threadIds.insert(scope.thread, tid);
+            out.append(",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":").append(QByteArray::number(tid))
+               .append(",\"args\":{\"name\":\"Worker ").append(QByteArray::number(tid - 1)).append("\"}}");
+        }
+        out.append(",\n{\"name\":\"").append(scope.name).append("\",\"cat\":\"").append(scope.category)
+           .append("\",\"ph\":\"X\",\"ts\":").append(QByteArray::number(scope.start))
+           .append(",\"dur\":").append(QByteArray::number(scope.duration))
+           .append(",\"pid\":1,\"tid\":").append(QByteArray::number(tid)).append('}');
+        if (out.size() > (1 << 20) - 512) {
+            file.write(out);
+            out.clear();
+        }
+    }
+    out.append("\n]}\n");
+    file.write(out);
+    return file.commit();
+}
+
+void Diagnostics::heartbeat()
+{
+    qint64 now = elapsed();
+    if (now - mLastBeat > (CHeartbeatInterval + CStallThreshold) * 1000)
+        reportStall(mLastBeat, now);
+    mLastBeat = now;
+}
+
+void Diagnostics::reportStall(qint64 from, qint64 to)
+{
+    struct Share {
+        const char *category;
+        const char *name;
+        qint64 time;
+        qint64 longest;
+    };
+    QVector<Share> shares;
+    {
+        // scopes are appended when they end, so the scan stops at the first one that ended before the stall
+        QMutexLocker locker(&mMutex);
+        int count = mWrapped ? mScopes.size() : mNextScope;
+        for (int i = 1; i <= count; ++i) {
+            const Scope &scope = mScopes.at((mNextScope - i + mScopes.size()) % mScopes.size());
+            if (scope.start + scope.duration < from) break;
+            if (scope.thread != mGuiThread) continue;
+            qint64 time = qMin(to, scope.start + scope.duration) - qMax(from, scope.start);
+            if (time <= 0) continue;
+            auto it = std::find_if(shares.begin(), shares.end(), [&scope](const Share &share) {
+                return qstrcmp(share.category, scope.category) == 0;
+            });
+            if (it == shares.end()) {
+                shares << Share {scope.category, scope.name, time, time};
+            } else {
+                it->time += time;
+                if (time > it->longest) {
+                    it->name = scope.name;
+                    it->longest = time;
+                }
+            }
+        }
+    }
+    std::sort(shares.begin(), shares.end(), [](const Share &a, const Share &b) { return a.time > b.time; });
+
+    qint64 stall = to - from - CHeartbeatInterval * 1000;
+    ++mStallCount;
+    mStallTime += stall;
+    QStringList parts;
+    for (int i = 0; i < shares.size() && i < CStallReportLimit; ++i)
+        parts << QString("%1 %2 ms (%3)").arg(shares.at(i).category).arg(shares.at(i).time / 1000)
+                 .arg(shares.at(i).name);
+    QString text = QString("GUI stall of %1 ms: %2").arg(stall / 1000)
+            .arg(parts.isEmpty() ? QString("no instrumented scope") : parts.join(", "));
+    SysLogLocator::systemLog()->append(text, LogMsgType::Warning);
+
+    // the stall itself becomes part of the trace
+    QMutexLocker locker(&mMutex);
+    if (mScopes.isEmpty()) return;
+    mScopes[mNextScope] = Scope {"stall", "GUI stall", from, to - from, mGuiThread};
+    if (++mNextScope == mScopes.size()) {
+        mNextScope = 0;
+        mWrapped = true;
+    }
+}
+
+} // namespace studio
+} // namespace gams
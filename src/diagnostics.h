@@ -0,0 +1,116 @@
+/*
+ * This file is part of the GAMS Studio project.
+ *
+ * Copyright (c) 2017-2020 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2020 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef DIAGNOSTICS_H
+#define DIAGNOSTICS_H
+
+#include <QObject>
+#include <QElapsedTimer>
+#include <QTimer>
+#include <QMutex>
+#include <QVector>
+#include <QAtomicInt>
+
+namespace gams {
+namespace studio {
+
+///
+/// \brief The Diagnostics class monitors the latency of the GUI event loop and records the instrumented scopes.
+///
+/// The monitor is opt-in (command line option <c>--diagnostics</c>). While inactive, a <c>DIAGNOSE()</c> scope costs
+/// a single atomic read. While active, a heartbeat timer in the GUI thread detects stalls of the event loop and
+/// reports them to the system log, naming the scopes that kept the GUI thread busy. On exit all recorded scopes are
+/// written to a trace file in the Chrome trace event format (viewable in chrome://tracing or Perfetto).
+///
+class Diagnostics : public QObject
+{
+    Q_OBJECT
+public:
+    struct Scope {
+        const char *category;
+        const char *name;
+        qint64 start;       // in microseconds since the monitor started
+        qint64 duration;    // in microseconds
+        quintptr thread;
+    };
+
+    static Diagnostics *instance();
+    static bool isActive() { return mActive.loadAcquire(); }
+
+    void start(const QString &traceFile);
+    qint64 elapsed() const;
+    void addScope(const char *category, const char *name, qint64 start);
+    bool writeTrace(const QString &fileName) const;
+
+public slots:
+    void stop();
+
+private slots:
+    void heartbeat();
+
+private:
+    Diagnostics();
+    QVector<Scope> snapshot() const;
+    void reportStall(qint64 from, qint64 to);
+
+private:
+    static const int CMaxScopes = 200000;       // ring buffer size of recorded scopes
+    static const int CHeartbeatInterval = 20;   // in milliseconds
+    static const int CStallThreshold = 150;     // delay of the heartbeat that counts as a stall, in milliseconds
+    static const int CStallReportLimit = 3;     // number of categories named in a stall report
+
+    static Diagnostics *mInstance;
+    static QAtomicInt mActive;
+    QElapsedTimer mClock;
+    QTimer mHeartbeat;
+    qint64 mLastBeat = 0;
+    quintptr mGuiThread = 0;
+    QString mTraceFile;
+    mutable QMutex mMutex;
+    QVector<Scope> mScopes;
+    int mNextScope = 0;
+    bool mWrapped = false;
+    int mStallCount = 0;
+    qint64 mStallTime = 0;
+};
+
+///
+/// \brief The DiagnosticScope class records the runtime of the enclosing scope if the diagnostics are active.
+///
+class DiagnosticScope
+{
+public:
+    DiagnosticScope(const char *category, const char *name)
+        : mCategory(category), mName(name),
+          mStart(Diagnostics::isActive() ? Diagnostics::instance()->elapsed() : -1) {}
+    ~DiagnosticScope() {
+        if (mStart >= 0) Diagnostics::instance()->addScope(mCategory, mName, mStart);
+    }
+private:
+    const char *mCategory;
+    const char *mName;
+    qint64 mStart;
+};
+
+} // namespace studio
+} // namespace gams
+
+#define DIAGNOSE(category) gams::studio::DiagnosticScope _GamsDiagnosticScope_(category, __func__);
+
+#endif // DIAGNOSTICS_H
@@ -33,12 +33,18 @@
 #include "search/searchlocator.h"
 #include "editors/navigationhistory.h"
 #include "editors/navigationhistorylocator.h"
+#include "file/includegraph.h"
 
 namespace gams {
 namespace studio {
 
 inline const KeySeqList &hotkey(Hotkey _hotkey) { return Keys::instance().keySequence(_hotkey); }
 
+static const int CMaxCachedBlocks = 2000;     // count of blocks to keep matches for
+
+// matches \w of a QRegularExpression
+inline bool isWordChar(QChar c) { return c.unicode() < 128 && (c.isLetterOrNumber() || c == '_'); }
+
 CodeEdit::CodeEdit(QWidget *parent)
     : AbstractEdit(parent)
 {
@@ -579,29 +585,52 @@ bool CodeEdit::toggleFolding(QTextBlock block)
 void CodeEdit::foldAll()
 {
     if (mBlockEdit) endBlockEdit();
-    // TODO(JM) the current implementation could be improved for nested blocks
-//    QList<BlockData*> stack;
+    static QString parentheses("{[(/EMTCPIOF}])\\emtcpiof");
+    static int pSplit = parentheses.length()/2;
+    struct OpenPar {
+        QChar closing;
+        syntax::BlockData *foldData;   // set if this parenthesis starts the fold of its block
+        int blockNr;
+    };
 
-    int foldRemain = 0;
+    // match all parentheses in a single pass (instead of calling matchParentheses for each fold start)
+    QVector<OpenPar> parStack;
     QTextBlock block = document()->firstBlock();
     while (block.isValid()) {
-        if (foldRemain-- > 0) block.setVisible(false);
-        bool folded;
-        int foldPos = foldStart(block.blockNumber(), folded);
-        if (foldPos >= 0) {
-//            stack << static_cast<BlockData*>(block.userData());
-            QTextCursor cursor(block);
-            cursor.setPosition(cursor.position() + foldPos+1);
-            int foldCount;
-            PositionPair pp = matchParentheses(cursor, true, &foldCount);
-            syntax::BlockData *dat = syntax::BlockData::fromTextBlock(block);
-            if (!pp.isNull() && pp.valid && dat) {
-                dat->setFoldCount(foldCount);
-                if (foldRemain < foldCount) foldRemain = foldCount;
+        syntax::BlockData *dat = syntax::BlockData::fromTextBlock(block);
+        // fold counts of earlier states may be outdated, only matched fold starts get a new count below
+        if (dat) dat->setFoldCount(0);
+        if (dat && !dat->isEmpty()) {
+            bool folded;
+            int foldPos = foldStart(block.blockNumber(), folded);
+            for (const syntax::ParenthesesPos &par: dat->parentheses()) {
+                int i = parentheses.indexOf(par.character);
+                if (i < 0) continue;
+                if (i < pSplit) {
+                    parStack << OpenPar{parentheses.at(i+pSplit), par.relPos == foldPos ? dat : nullptr,
+                                        block.blockNumber()};
+                } else if (!parStack.isEmpty() && parStack.last().closing == par.character) {
+                    OpenPar open = parStack.takeLast();
+                    if (open.foldData) open.foldData->setFoldCount(block.blockNumber() - open.blockNr);
+                } else {
+                    // bad parentheses invalidate all open folds
+                    parStack.clear();
+                }
             }
         }
         block = block.next();
     }
+
+    // hide the folded blocks
+    int foldRemain = 0;
+    block = document()->firstBlock();
+    while (block.isValid()) {
+        if (foldRemain-- > 0) block.setVisible(false);
+        syntax::BlockData *dat = syntax::BlockData::fromTextBlock(block);
+        if (dat && dat->isFolded() && foldRemain < dat->foldCount())
+            foldRemain = dat->foldCount();
+        block = block.next();
+    }
     checkCursorAfterFolding();
     mFoldMark = LinePair();
     document()->adjustSize();
@@ -742,42 +771,11 @@ QString CodeEdit::resolveHRef(QString href)
 
 QString CodeEdit::getIncludeFile(int line, int &fileStart, QString &code)
 {
-    QString res;
     code = "INC";
     QTextBlock block = document()->findBlockByNumber(line);
     fileStart = block.length();
-    if (block.isValid()) {
-        QRegularExpression rex;
-        rex.setPattern(QString("(^%1|%1%1)\\s*([\\w]+)\\s*").arg(QRegularExpression::escape("$")));
-        QRegularExpressionMatch match = rex.match(block.text());
-        if (match.captured(2).length() < block.length()) {
-            QChar endChar(' ');
-            QString command = match.captured(2).toUpper();
-            if (command == "INCLUDE") {
-                fileStart = match.capturedEnd();
-                endChar = QChar();
-                res = block.text().mid(fileStart, block.text().length()).trimmed();
-            } else if (command.endsWith("INCLUDE")) { // batInclude, sysInclude, libInclude
-                if (command.at(0) != 'B') code = command.left(3);
-                fileStart = match.capturedEnd();
-                res = block.text().mid(fileStart, block.text().length()).trimmed();
-            }
-            if (!res.isEmpty()) {
-                if (block.text().at(fileStart) == '\"') endChar = '\"';
-                if (block.text().at(fileStart) == '\'') endChar = '\'';
-                if (endChar != QChar()) {
-                    int w = (endChar==' ') ? 0 : 1;
-                    int end = res.indexOf(endChar, 1) + w;
-                    if (end) {
-                        res = res.mid(w, end - 2*w);
-                        fileStart += w;
-                    }
-                }
-            }
-        }
-    }
-//    DEB() << "FILE: " << res;
-    return res;
+    if (!block.isValid()) return QString();
+    return IncludeGraph::includeFile(block.text(), fileStart, code);
 }
 
 TextLinkType CodeEdit::checkLinks(const QPoint &mousePos, bool greedy, QString *fName)
@@ -1094,6 +1092,14 @@ void CodeEdit::contextMenuEvent(QContextMenuEvent* e)
             actLink->setEnabled(false);
         }
 
+        QString word;
+        int iKind = 0;
+        wordInfo(cursorForPosition(e->pos()), word, iKind);
+        bool found = false;
+        if (!word.isEmpty()) emit hasDeclaration(word, found);
+        QAction *actDecl = menu->addAction("Go to declaration", [this, word]() { emit jumpToDeclaration(word); });
+        actDecl->setEnabled(found);
+
         QMenu *submenu = menu->addMenu(tr("Advanced"));
         QList<QAction*> ret;
         emit requestAdvancedActions(&ret);
@@ -1136,27 +1142,23 @@ void CodeEdit::updateLinkAppearance(QPoint pos, bool active)
 void CodeEdit::marksChanged(const QSet<int> dirtyLines)
 {
     AbstractEdit::marksChanged(dirtyLines);
-    bool doPaint = dirtyLines.isEmpty() || dirtyLines.size() > 5;
-    if (!doPaint) {
-        int firstLine = topVisibleLine();
-        for (const int &line: dirtyLines) {
-            if (line >= firstLine && line <= firstLine+100) {
-                doPaint = true;
-                break;
-            }
-        }
-    }
-    if (doPaint) {
+    // an empty set stands for a complete change, otherwise only the visible rows of the dirty lines are painted
+    if (dirtyLines.isEmpty()) {
         mLineNumberArea->update();
-        updateLineNumberAreaWidth();
+    } else {
+        QRect dirty = lineNrAreaRect(dirtyLines);
+        if (!dirty.isEmpty()) mLineNumberArea->update(dirty);
     }
+    updateLineNumberAreaWidth();
 }
 
 void CodeEdit::blockCountHasChanged(int newBlockCount)
 {
     Q_UNUSED(newBlockCount)
+    // the rows of moved blocks arrive through updateRequest, only the fold mark has to be cleared here
+    QRect dirty = lineNrAreaRect(mFoldMark);
     mFoldMark = LinePair();
-    mLineNumberArea->update();
+    if (!dirty.isEmpty()) mLineNumberArea->update(dirty);
     updateLineNumberAreaWidth();
 }
 
@@ -1548,7 +1550,7 @@ int CodeEdit::foldStart(int line, bool &folded, QString *closingSymbol) const
     if (!dat) return -1;
 
     folded = dat->isFolded();
-    QVector<syntax::ParenthesesPos> parList = dat->parentheses();
+    const QVector<syntax::ParenthesesPos> &parList = dat->parentheses();
     int depth = 0;
 //    if (parList.count())
 //        DEB() << "parenthesis " << parList.at(0).character << " at " << parList.at(0).relPos;
@@ -1586,20 +1588,20 @@ PositionPair CodeEdit::matchParentheses(QTextCursor cursor, bool all, int *foldC
     if (!block.userData()) return PositionPair();
     syntax::BlockData *startDat = syntax::BlockData::fromTextBlock(block);
 //    int state = block.userState();
-    QVector<syntax::ParenthesesPos> parList = startDat->parentheses();
+    const QVector<syntax::ParenthesesPos> *parList = &startDat->parentheses();
     int pos = cursor.positionInBlock();
     int start = -1;
-    for (int i = parList.count()-1; i >= 0; --i) {
-        if (parList.at(i).relPos == pos || parList.at(i).relPos == pos-1) {
+    for (int i = parList->count()-1; i >= 0; --i) {
+        if (parList->at(i).relPos == pos || parList->at(i).relPos == pos-1) {
             start = i;
         }
     }
     if (start < 0) return PositionPair();
     // prepare matching search
-    int ci = parentheses.indexOf(parList.at(start).character);
+    int ci = parentheses.indexOf(parList->at(start).character);
     bool back = ci >= pSplit;
     ci = ci % pSplit;
-    PositionPair result(block.position() + parList.at(start).relPos);
+    PositionPair result(block.position() + parList->at(start).relPos);
     result.match = result.pos;
     QStringRef parEnter = parentheses.midRef(back ? pSplit : 0, pSplit);
     QStringRef parLeave = parentheses.midRef(back ? 0 : pSplit, pSplit);
@@ -1609,7 +1611,7 @@ PositionPair CodeEdit::matchParentheses(QTextCursor cursor, bool all, int *foldC
     int pi = start;
     while (block.isValid()) {
         // get next parentheses entry
-        if (back ? --pi < 0 : ++pi >= parList.count()) {
+        if (back ? --pi < 0 : ++pi >= parList->count()) {
             bool isEmpty = true;
             while (block.isValid() && isEmpty) {
                 block = back ? block.previous() : block.next();
@@ -1617,30 +1619,29 @@ PositionPair CodeEdit::matchParentheses(QTextCursor cursor, bool all, int *foldC
                 if (foldCount) *foldCount = block.blockNumber() - startBlockNr;
                 syntax::BlockData *dat = syntax::BlockData::fromTextBlock(block);
                 if (dat) {
-                    parList = dat->parentheses();
-                    if (!parList.isEmpty()) isEmpty = false;
+                    parList = &dat->parentheses();
+                    if (!parList->isEmpty()) isEmpty = false;
                 }
             }
             if (isEmpty) continue;
-            parList = syntax::BlockData::fromTextBlock(block)->parentheses();
-            pi = back ? parList.count()-1 : 0;
+            pi = back ? parList->count()-1 : 0;
         }
 
-        int i = parEnter.indexOf(parList.at(pi).character);
+        int i = parEnter.indexOf(parList->at(pi).character);
         if (i < 0) {
             // Only last stacked character is valid
-            if (parList.at(pi).character == parStack.last()) {
+            if (parList->at(pi).character == parStack.last()) {
                 parStack.removeLast();
                 if (parStack.isEmpty()) {
                     if (!all && ci > pAll) return PositionPair(); // only mark embedded on mismatch
                     result.valid = true;
-                    result.match = block.position() + parList.at(pi).relPos;
+                    result.match = block.position() + parList->at(pi).relPos;
                     return result;
                 }
             } else {
                 // Mark bad parentheses
                 parStack.clear();
-                result.match = block.position() + parList.at(pi).relPos;
+                result.match = block.position() + parList->at(pi).relPos;
                 return result;
             }
         } else {
@@ -1762,21 +1763,15 @@ void CodeEdit::extraSelCurrentWord(QList<QTextEdit::ExtraSelection> &selections)
 {
     if (!mWordUnderCursor.isEmpty()) {
         QTextBlock block = firstVisibleBlock();
-        QRegularExpression rex(QString("(?i)(^|[^\\w]|-)(%1)($|[^\\w]|-)").arg(mWordUnderCursor));
-        QRegularExpressionMatch match;
+        QTextEdit::ExtraSelection selection;
+        selection.cursor = textCursor();
+        selection.format.setBackground(toColor(Scheme::Edit_currentWordBg));
         int top = qRound(blockBoundingGeometry(block).translated(contentOffset()).top());
         while (block.isValid() && top < viewport()->height()) {
-            int i = 0;
-            while (true) {
-                i = block.text().indexOf(rex, i, &match);
-                if (i < 0) break;
-                QTextEdit::ExtraSelection selection;
-                selection.cursor = textCursor();
-                selection.cursor.setPosition(block.position()+match.capturedStart(2));
-                selection.cursor.setPosition(block.position()+match.capturedEnd(2), QTextCursor::KeepAnchor);
-                selection.format.setBackground(toColor(Scheme::Edit_currentWordBg));
+            for (const QPair<int,int> &match: wordMatches(block, mWordUnderCursor)) {
+                selection.cursor.setPosition(block.position() + match.first);
+                selection.cursor.setPosition(block.position() + match.first + match.second, QTextCursor::KeepAnchor);
                 selections << selection;
-                i += match.capturedLength(1) + match.capturedLength(2);
             }
             top += qRound(blockBoundingRect(block).height());
             block = block.next();
@@ -1784,6 +1779,45 @@ void CodeEdit::extraSelCurrentWord(QList<QTextEdit::ExtraSelection> &selections)
     }
 }
 
+QVector<QPair<int, int> > CodeEdit::wordMatches(const QTextBlock &block, const QString &word) const
+{
+    // The word under cursor is a plain identifier, so a case insensitive search for the literal is sufficient.
+    // It is as cheap as validating a cached result against the block text, so the matches aren't cached.
+    // A match needs non-word characters (or the line borders) on both sides.
+    QVector<QPair<int,int>> matches;
+    const QString text = block.text();
+    int i = 0;
+    while ((i = text.indexOf(word, i, Qt::CaseInsensitive)) >= 0) {
+        int end = i + word.length();
+        if ((i == 0 || !isWordChar(text.at(i-1))) && (end == text.length() || !isWordChar(text.at(end)))) {
+            matches << qMakePair(i, word.length());
+            i = end;
+        } else {
+            ++i;
+        }
+    }
+    return matches;
+}
+
+const QVector<QPair<int, int> > &CodeEdit::regexMatches(const QTextBlock &block, const QRegularExpression &regEx)
+{
+    if (mSearchMatches.blocks.size() > CMaxCachedBlocks)
+        mSearchMatches.reset(mSearchMatches.pattern);
+    const QString text = block.text();
+    BlockMatches &bm = mSearchMatches.blocks[block.blockNumber()];
+    if (bm.valid && bm.text == text) return bm.matches;
+
+    bm.valid = true;
+    bm.text = text;
+    bm.matches.clear();
+    QRegularExpressionMatchIterator i = regEx.globalMatch(text);
+    while (i.hasNext()) {
+        QRegularExpressionMatch m = i.next();
+        bm.matches << qMakePair(m.capturedStart(0), m.capturedLength(0));
+    }
+    return bm.matches;
+}
+
 bool CodeEdit::extraSelMatchParentheses(QList<QTextEdit::ExtraSelection> &selections, bool first)
 {
     if (mParenthesesMatch.isNull())
@@ -1822,25 +1856,23 @@ void CodeEdit::extraSelMatches(QList<QTextEdit::ExtraSelection> &selections)
     if (search->filteredResultList(ViewHelper::location(this)).isEmpty()) return;
 
     QRegularExpression regEx = search->regex();
+    QString cacheKey = regEx.pattern() + '\n' + QString::number(regEx.patternOptions());
+    if (mSearchMatches.pattern != cacheKey)
+        mSearchMatches.reset(cacheKey);
 
+    QTextEdit::ExtraSelection selection;
+    selection.cursor = QTextCursor(document());
+    selection.format.setForeground(Qt::white);
+    selection.format.setBackground(toColor(Scheme::Edit_matchesBg));
     QTextBlock block = firstVisibleBlock();
     int top = qRound(blockBoundingGeometry(block).translated(contentOffset()).top());
     while (block.isValid() && top < viewport()->height()) {
         top += qRound(blockBoundingRect(block).height());
-
-        QRegularExpressionMatchIterator i = regEx.globalMatch(block.text());
-        while (i.hasNext()) {
-            QRegularExpressionMatch m = i.next();
-            QTextEdit::ExtraSelection selection;
-            QTextCursor tc(document());
-            tc.setPosition(block.position() + m.capturedStart(0));
-            tc.movePosition(QTextCursor::Right, QTextCursor::KeepAnchor, m.capturedLength(0));
-            selection.cursor = tc;
-            selection.format.setForeground(Qt::white);
-            selection.format.setBackground(toColor(Scheme::Edit_matchesBg));
+        for (const QPair<int,int> &match: regexMatches(block, regEx)) {
+            selection.cursor.setPosition(block.position() + match.first);
+            selection.cursor.movePosition(QTextCursor::Right, QTextCursor::KeepAnchor, match.second);
             selections << selection;
         }
-
         block = block.next();
     }
 }
@@ -1888,9 +1920,101 @@ QString CodeEdit::getToolTipText(const QPoint &pos)
     return fileName;
 }
 
-QString CodeEdit::lineNrText(int blockNr)
+const CodeEdit::LineNrStyle &CodeEdit::lineNrStyle()
+{
+    LineNrStyle &style = mLineNrStyle;
+    qreal devicePixelRatio = mLineNumberArea->devicePixelRatioF();
+    if (style.generation == Scheme::instance()->generation() && style.font == font()
+            && qFuzzyCompare(style.devicePixelRatio, devicePixelRatio))
+        return style;
+    style.generation = Scheme::instance()->generation();
+    style.font = font();
+    style.devicePixelRatio = devicePixelRatio;
+    for (int bold = 0; bold < 2; ++bold) {
+        style.fonts[bold] = font();
+        style.fonts[bold].setBold(bold);
+        QFontMetrics metrics(style.fonts[bold]);
+        for (int digit = 0; digit < 10; ++digit) {
+            QStaticText &glyph = style.digits[bold][digit];
+            glyph.setText(QString(QChar('0' + digit)));
+            glyph.setTextFormat(Qt::PlainText);
+            glyph.setPerformanceHint(QStaticText::AggressiveCaching);
+            glyph.prepare(QTransform(), style.fonts[bold]);
+            style.advances[bold][digit] = metrics.horizontalAdvance(QChar('0' + digit));
+        }
+    }
+    style.foreground[0] = toColor(Scheme::Edit_linenrAreaFg);
+    style.foreground[1] = toColor(Scheme::Edit_linenrAreaMarkFg);
+    style.background = toColor(Scheme::Edit_linenrAreaBg);
+    style.markBackground = toColor(Scheme::Edit_linenrAreaMarkBg);
+    style.foldBackground = toColor(Scheme::Edit_linenrAreaFoldBg);
+    style.invalidFoldBackground = toColor(Scheme::Edit_parenthesesInvalidBg);
+    style.foldLine = toColor(Scheme::Edit_foldLineBg);
+    // QIcon::pixmap() takes the ratio of the application, the area may be on a screen with another ratio
+    int size = iconSize()-2;
+    QIcon icons[2] = {Scheme::icon(":/solid/triangle-down", true), Scheme::icon(":/solid/triangle-right", true)};
+    QPixmap *pixmaps[2] = {&style.foldOpen, &style.foldClosed};
+    for (int i = 0; i < 2; ++i) {
+        QPixmap pixmap(QSize(size, size) * devicePixelRatio);
+        pixmap.fill(Qt::transparent);
+        QPainter painter(&pixmap);
+        icons[i].paint(&painter, pixmap.rect());
+        painter.end();
+        pixmap.setDevicePixelRatio(devicePixelRatio);
+        *pixmaps[i] = pixmap;
+    }
+    return style;
+}
+
+void CodeEdit::paintLineNr(QPainter &painter, int lineNr, int right, int top, int bold)
+{
+    const LineNrStyle &style = mLineNrStyle;
+    int x = right;
+    do {
+        int digit = lineNr % 10;
+        x -= style.advances[bold][digit];
+        painter.drawStaticText(x, top, style.digits[bold][digit]);
+        lineNr /= 10;
+    } while (lineNr);
+}
+
+QRect CodeEdit::lineNrAreaRect(const LinePair &lines)
+{
+    if (lines.pos < 0 || lines.match < lines.pos) return QRect();
+    // walk the visible blocks only, the geometry of blocks far off the viewport is expensive
+    QTextBlock block = firstVisibleBlock();
+    int top = static_cast<int>(blockBoundingGeometry(block).translated(contentOffset()).top());
+    int from = -1;
+    int to = -1;
+    while (block.isValid() && top <= mLineNumberArea->height() && block.blockNumber() <= lines.match) {
+        int bottom = top + static_cast<int>(blockBoundingRect(block).height());
+        if (block.blockNumber() >= lines.pos) {
+            if (from < 0) from = top;
+            to = bottom;
+        }
+        top = bottom;
+        block = block.next();
+    }
+    if (from < 0) return QRect();
+    return QRect(0, from, mLineNumberArea->width(), to - from + 1);
+}
+
+QRect CodeEdit::lineNrAreaRect(const QSet<int> &lines)
 {
-    return QString::number(blockNr);
+    if (lines.isEmpty()) return QRect();
+    int first = *std::min_element(lines.begin(), lines.end());
+    int last = *std::max_element(lines.begin(), lines.end());
+    QRect res;
+    QTextBlock block = firstVisibleBlock();
+    int top = static_cast<int>(blockBoundingGeometry(block).translated(contentOffset()).top());
+    while (block.isValid() && top <= mLineNumberArea->height() && block.blockNumber() <= last) {
+        int bottom = top + static_cast<int>(blockBoundingRect(block).height());
+        if (block.blockNumber() >= first && lines.contains(block.blockNumber()))
+            res |= QRect(0, top, mLineNumberArea->width(), bottom - top + 1);
+        top = bottom;
+        block = block.next();
+    }
+    return res;
 }
 
 bool CodeEdit::showLineNr() const
@@ -1929,6 +2053,7 @@ void CodeEdit::lineNumberAreaPaintEvent(QPaintEvent *event)
         event->accept();
         return;
     }
+    const LineNrStyle &style = lineNrStyle();
     QTextBlock block = firstVisibleBlock();
     int blockNumber = block.blockNumber();
     QRectF fRect = blockBoundingGeometry(block).translated(contentOffset());
@@ -1939,11 +2064,16 @@ void CodeEdit::lineNumberAreaPaintEvent(QPaintEvent *event)
     if (markFrom > markTo) qSwap(markFrom, markTo);
 
     QRect paintRect(event->rect());
-    painter.fillRect(paintRect, toColor(Scheme::Edit_linenrAreaBg));
+    painter.fillRect(paintRect, style.background);
     int widthForNr = mLineNumberArea->width() - (showFolding() ? iconSize() : 0);
+    bool lineNr = showLineNr();
+    int painterBold = -1;
 
     QRect markRect(paintRect.left(), top, paintRect.width(), static_cast<int>(fRect.height())+1);
     QRect foldRect(widthForNr, top, paintRect.width()-widthForNr, static_cast<int>(fRect.height())+1);
+    // the marks of the visible lines are walked along with the blocks
+    LineMarks::const_iterator markIt;
+    if (hasMarks) markIt = marks()->lowerBound(absoluteBlockNr(blockNumber));
     while (block.isValid() && top <= paintRect.bottom()) {
         if (block.isVisible() && bottom >= paintRect.top()) {
             bool mark = mBlockEdit ? mBlockEdit->hasBlock(block.blockNumber())
@@ -1951,22 +2081,27 @@ void CodeEdit::lineNumberAreaPaintEvent(QPaintEvent *event)
             if (mark) {
                 markRect.moveTop(top);
                 markRect.setHeight(bottom-top);
-                painter.fillRect(markRect, toColor(Scheme::Edit_linenrAreaMarkBg));
+                painter.fillRect(markRect, style.markBackground);
             }
 
-            if(showLineNr()) {
-                QString number = lineNrText(blockNumber + 1);
-                QFont f = font();
-                f.setBold(mark);
-                painter.setFont(f);
-                painter.setPen(mark ? toColor(Scheme::Edit_linenrAreaMarkFg)
-                                    : toColor(Scheme::Edit_linenrAreaFg));
-                painter.drawText(0, top, widthForNr, fontMetrics().height(), Qt::AlignRight, number);
+            if (lineNr) {
+                int bold = mark ? 1 : 0;
+                if (bold != painterBold) {
+                    // font and pen only change between the cursor lines and the others
+                    painter.setFont(style.fonts[bold]);
+                    painter.setPen(style.foreground[bold]);
+                    painterBold = bold;
+                }
+                paintLineNr(painter, blockNumber + 1, widthForNr, top, bold);
             }
 
-            if (hasMarks && marks()->contains(absoluteBlockNr(blockNumber))) {
-                int iTop = (2+top+bottom-iconSize())/2;
-                painter.drawPixmap(1, iTop, marks()->value(absoluteBlockNr(blockNumber))->icon().pixmap(iconSize(),iconSize()));
+            if (hasMarks) {
+                int absLine = absoluteBlockNr(blockNumber);
+                while (markIt != marks()->constEnd() && markIt.key() < absLine) ++markIt;
+                if (markIt != marks()->constEnd() && markIt.key() == absLine) {
+                    int iTop = (2+top+bottom-iconSize())/2;
+                    painter.drawPixmap(1, iTop, markIt.value()->icon().pixmap(iconSize(),iconSize()));
+                }
             }
             if (showFolding()) {
                 bool folded = false;
@@ -1974,19 +2109,14 @@ void CodeEdit::lineNumberAreaPaintEvent(QPaintEvent *event)
                 if (foldRes > 2) {
                     foldRect.moveTop(top);
                     foldRect.setHeight(bottom-top);
-                    if (mFoldMark.valid) {
-                        painter.fillRect(foldRect, toColor(Scheme::Edit_linenrAreaFoldBg));
-                    } else {
-                        painter.fillRect(foldRect, toColor(Scheme::Edit_parenthesesInvalidBg));
-                    }
+                    painter.fillRect(foldRect, mFoldMark.valid ? style.foldBackground : style.invalidFoldBackground);
                 }
                 if (foldRes % 3 > 0) {
                     int iTop = top + (4+fontMetrics().height()-iconSize())/2;
-                    QIcon icon = Scheme::icon(foldRes % 3 == 2 ? ":/solid/triangle-right" : ":/solid/triangle-down", true);
-                    painter.drawPixmap(widthForNr+1, iTop, icon.pixmap(iconSize()-2,iconSize()-2));
+                    painter.drawPixmap(widthForNr+1, iTop, foldRes % 3 == 2 ? style.foldClosed : style.foldOpen);
                     if (foldRes % 3 == 2) {
                         QRect foldRect(0, bottom-1, width(), 1);
-                        painter.fillRect(foldRect, toColor(Scheme::Edit_foldLineBg));
+                        painter.fillRect(foldRect, style.foldLine);
                     }
                 }
           }
@@ -2428,8 +2558,10 @@ void LineNumberArea::mouseMoveEvent(QMouseEvent *event)
         newFoldMark = mCodeEditor->findFoldBlock(block.blockNumber(), true);
     }
     if (newFoldMark != mCodeEditor->mFoldMark) {
+        // only the rows of the previous and the new fold block change
+        QRect dirty = mCodeEditor->lineNrAreaRect(mCodeEditor->mFoldMark) | mCodeEditor->lineNrAreaRect(newFoldMark);
         mCodeEditor->mFoldMark = newFoldMark;
-        update(rect());
+        if (!dirty.isEmpty()) update(dirty);
     }
     if (mNoCursorFocus) {
         event->accept();
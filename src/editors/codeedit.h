@@ -24,6 +24,7 @@
 #include <QHash>
 #include <QIcon>
 #include <QTimer>
+#include <QStaticText>
 #include "editors/abstractedit.h"
 #include "syntax/textmark.h"
 #include "syntax/blockdata.h"
@@ -116,7 +117,6 @@ protected:
     void wheelEvent(QWheelEvent *e) override;
     void paintEvent(QPaintEvent *e) override;
     void contextMenuEvent(QContextMenuEvent *e) override;
-    virtual QString lineNrText(int blockNr);
     virtual bool showLineNr() const;
     virtual bool showFolding() const;
     void setAllowBlockEdit(bool allow);
@@ -144,6 +144,8 @@ signals:
     void requestAdvancedActions(QList<QAction*>* actions);
     void hasHRef(const QString &href, QString &fileName);
     void jumpToHRef(const QString &href);
+    void hasDeclaration(const QString &symbol, bool &found);
+    void jumpToDeclaration(const QString &symbol);
 
 public slots:
     void clearSelection();
@@ -241,6 +243,40 @@ protected:
 protected:
     BlockEdit* blockEdit() {return mBlockEdit;}
 
+private:
+    struct BlockMatches {
+        bool valid = false;
+        QString text;                       // block text the matches were found in (implicitly shared)
+        QVector<QPair<int,int>> matches;    // start and length of each match in the block
+    };
+    struct MatchCache {                     // matches of a pattern for each block number
+        QString pattern;
+        QHash<int, BlockMatches> blocks;
+        void reset(const QString &newPattern = QString()) { pattern = newPattern; blocks.clear(); }
+    };
+    QVector<QPair<int,int>> wordMatches(const QTextBlock &block, const QString &word) const;
+    const QVector<QPair<int,int>> &regexMatches(const QTextBlock &block, const QRegularExpression &regEx);
+    struct LineNrStyle {                    // fonts, colors and glyphs of the line number area
+        int generation = -1;                // generation of the Scheme the style was built for
+        QFont font;                         // editor font the style was built for
+        qreal devicePixelRatio = 0.0;       // device pixel ratio the fold pixmaps were built for
+        QFont fonts[2];                     // normal and bold (for the lines of the cursor)
+        QStaticText digits[2][10];
+        int advances[2][10];
+        QColor foreground[2];
+        QColor background;
+        QColor markBackground;
+        QColor foldBackground;
+        QColor invalidFoldBackground;
+        QColor foldLine;
+        QPixmap foldOpen;
+        QPixmap foldClosed;
+    };
+    const LineNrStyle &lineNrStyle();
+    void paintLineNr(QPainter &painter, int lineNr, int right, int top, int bold);
+    QRect lineNrAreaRect(const LinePair &lines);
+    QRect lineNrAreaRect(const QSet<int> &lines);
+
 private:
     LineNumberArea *mLineNumberArea;
     int mCurrentCol;
@@ -266,6 +302,8 @@ private:
     LinePair mFoldMark;
     int mIncludeLinkLine = -1;
     bool mLinkActive = false;
+    MatchCache mSearchMatches;
+    LineNrStyle mLineNrStyle;
 };
 
 class LineNumberArea : public QWidget
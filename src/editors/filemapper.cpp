@@ -20,6 +20,7 @@
 #include "filemapper.h"
 #include "exception.h"
 #include "logger.h"
+#include "diagnostics.h"
 #include <QFile>
 #include <QTextStream>
 #include <QGuiApplication>
@@ -98,6 +99,7 @@ FileMapper::Chunk* FileMapper::getChunk(int chunkNr, bool cache) const
     // if the Chunk is cached, return it directly
     Chunk *res = getFromCache(chunkNr);
     if (res) return res;
+    DIAGNOSE("mapper")
 
     // determine start of the chunk
     qint64 chunkStart = qint64(chunkNr) * chunkSize();
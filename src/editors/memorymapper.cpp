@@ -20,6 +20,7 @@
 #include "memorymapper.h"
 #include "file/dynamicfile.h"
 #include "logger.h"
+#include "diagnostics.h"
 #include "scheme.h"
 
 namespace gams {
@@ -31,6 +32,8 @@ static int CDirectErrors = 3;       // The count of errors created immediately
 static int CParseLinesMax = 23;     // The maximum count of gathered lines befor updating the display
 static int CRefreshTimeMax = 100;    // The maximum time (in ms) to wait until the output is updated (after changed)
 static int CKeptRunCount = 5;
+static int CResidentChunks = 8;     // The maximum count of chunks kept in memory, older chunks are spilled to disk
+static int CPagedChunks = 5;        // The maximum count of spilled chunks paged in at the same time
 
 MemoryMapper::MemoryMapper(QObject *parent) : AbstractTextMapper (parent)
 {
@@ -78,6 +81,7 @@ MemoryMapper::~MemoryMapper()
 {
     while (!mChunks.isEmpty())
         removeChunk(mChunks.last()->nr);
+    clearSpill();
 
     setLogParser(nullptr);
 }
@@ -121,7 +125,8 @@ AbstractTextMapper::Chunk *MemoryMapper::addChunk(bool startUnit)
         }
         return mChunks.last();
     }
-    // ELSE create the new chunk
+    // ELSE keep the memory bounded and create the new chunk
+    spillChunks();
     Chunk *chunk = new Chunk();
     chunk->bArray.resize(chunkSize());
     chunk->bStart = mChunks.size() ? mChunks.last()->bStart + mChunks.last()->size() : 0;
@@ -141,6 +146,69 @@ AbstractTextMapper::Chunk *MemoryMapper::addChunk(bool startUnit)
     return mChunks.last();
 }
 
+void MemoryMapper::spillChunks()
+{
+    if (mSpillFailed) return;
+    int resident = mChunks.size() - mSpillPos.size();
+    // the last chunk is still filled, so it stays in memory
+    for (int i = 0; i < mChunks.size()-1 && resident >= CResidentChunks; ++i) {
+        Chunk *chunk = mChunks.at(i);
+        if (mSpillPos.contains(chunk)) continue;
+        if (!spillChunk(chunk)) {
+            DEB() << "Could not spill log to " << mSpillFile.fileName() << ": " << mSpillFile.errorString();
+            mSpillFailed = true;
+            return;
+        }
+        --resident;
+    }
+}
+
+bool MemoryMapper::spillChunk(Chunk *chunk)
+{
+    if (!mSpillFile.isOpen() && !mSpillFile.open())
+        return false;
+    // the whole data up to the last line is written to keep the lineBytes valid
+    qint64 pos = mSpillFile.size();
+    int len = chunk->lineBytes.last();
+    if (!mSpillFile.seek(pos) || mSpillFile.write(chunk->bArray.constData(), len) != len)
+        return false;
+    mSpillPos.insert(chunk, pos);
+    chunk->bArray = QByteArray();
+    return true;
+}
+
+AbstractTextMapper::Chunk *MemoryMapper::pageIn(Chunk *chunk) const
+{
+    if (!chunk || !mSpillPos.contains(chunk)) return chunk;
+    int i = mPagedChunks.indexOf(chunk);
+    if (i >= 0) {
+        if (i < mPagedChunks.size()-1)
+            mPagedChunks.move(i, mPagedChunks.size()-1);
+        return chunk;
+    }
+    int len = chunk->lineBytes.last();
+    chunk->bArray.resize(qMax(chunkSize(), len+1));
+    if (!mSpillFile.seek(mSpillPos.value(chunk)) || mSpillFile.read(chunk->bArray.data(), len) != len) {
+        DEB() << "Could not read log from " << mSpillFile.fileName() << ": " << mSpillFile.errorString();
+        chunk->bArray.fill(' ');
+    }
+    if (mPagedChunks.size() == CPagedChunks)
+        mPagedChunks.takeFirst()->bArray = QByteArray();
+    mPagedChunks << chunk;
+    return chunk;
+}
+
+void MemoryMapper::clearSpill()
+{
+    mPagedChunks.clear();
+    mSpillPos.clear();
+    mSpillFailed = false;
+    if (mSpillFile.isOpen()) {
+        mSpillFile.resize(0);
+        mSpillFile.close();
+    }
+}
+
 void MemoryMapper::shrinkLog(qint64 minBytes)
 {
     const QByteArray ellipsis(QString("\n...\n\n").toLatin1().data());
@@ -148,6 +216,8 @@ void MemoryMapper::shrinkLog(qint64 minBytes)
     Chunk * chunk = mUnits.last().firstChunk;
     if (chunk->nr == mChunks.last()->nr || chunk->lineCount() < 2)
         return; // only one chunk in current unit
+    if (mSpillPos.contains(chunk))
+        return; // the head of the run has already been spilled
 
     if (!mShrinkLineCount) {
         // the first chunk in the unit starts at bArray[0]
@@ -192,6 +262,8 @@ void MemoryMapper::shrinkLog(qint64 minBytes)
 
 bool MemoryMapper::ensureSpace(qint64 bytes)
 {
+    // as long as older chunks can be spilled to disk the log is kept completely
+    if (!mSpillFailed) return false;
     if (size() - mUnits.last().firstChunk->bStart + bytes >= chunkSize() * 2) {
         shrinkLog(bytes);
         return true;
@@ -538,6 +610,7 @@ void MemoryMapper::clearLastLine()
 
 void MemoryMapper::fetchLog()
 {
+    DIAGNOSE("log parser")
     emit appendLines(mNewLogLines, mWeakLastLogLine);
     mNewLogLines.clear();
     mWeakLastLogLine = false;
@@ -545,6 +618,7 @@ void MemoryMapper::fetchLog()
 
 void MemoryMapper::fetchDisplay()
 {
+    DIAGNOSE("mapper")
     emit updateView();
     mNewLines = 0;
     mInstantRefresh = false;
@@ -578,6 +652,7 @@ void MemoryMapper::processPending()
 
 void MemoryMapper::addProcessData(const QByteArray &data)
 {
+    DIAGNOSE("log parser")
     Q_ASSERT_X(mChunks.size(), Q_FUNC_INFO, "Need to call startRun() before adding data.");
     Chunk *chunk = mChunks.last();
     int len = 0;
@@ -648,6 +723,7 @@ void MemoryMapper::reset()
 {
     while (!mChunks.isEmpty())
         removeChunk(mChunks.last()->nr);
+    clearSpill();
     mUnits.clear();
     invalidateSize();
     mLineCount = 0;
@@ -770,7 +846,7 @@ void MemoryMapper::dump()
               << "  lineCount " << chunk->lineCount() << "  metr:" << chunkMetrics(chunk->nr)->lineCount;
         int len = chunk->lineCount() ? chunk->lineBytes.at(1) - chunk->lineBytes.at(0) : 0;
         if (len)
-            DEB() << "   starts with: " << chunk->bArray.mid(chunk->lineBytes.at(0), len);
+            DEB() << "   starts with: " << pageIn(chunk)->bArray.mid(chunk->lineBytes.at(0), len);
         sum += chunk->size();
     }
 //    for (const Unit &u : mUnits) {
@@ -787,6 +863,7 @@ int MemoryMapper::knownLineNrs() const
 QString MemoryMapper::extractLstRef(LineRef lineRef)
 {
     if (!lineRef.chunk) return QString();
+    pageIn(lineRef.chunk);
     int lastCh = lineRef.chunk->lineBytes.at(lineRef.relLine+1)-2;
     if (lastCh - lineRef.chunk->lineBytes.at(lineRef.relLine) < 7) return QString();
     if (lineRef.chunk->bArray.at(lastCh) != ']') return QString();
@@ -813,11 +890,11 @@ QString MemoryMapper::findClosestLst(const int &localLine)
     LineRef foreRef = backRef;
     // take previous line while in error description (line starts with space)
     while(backRef.chunk &&
-          backRef.chunk->bArray.at(backRef.chunk->lineBytes.at(backRef.relLine)) == ' ')
+          pageIn(backRef.chunk)->bArray.at(backRef.chunk->lineBytes.at(backRef.relLine)) == ' ')
         backRef = prevRef(backRef);
     // take next line while in error description (line starts with space)
     while(foreRef.chunk &&
-          foreRef.chunk->bArray.at(foreRef.chunk->lineBytes.at(foreRef.relLine)) == ' ')
+          pageIn(foreRef.chunk)->bArray.at(foreRef.chunk->lineBytes.at(foreRef.relLine)) == ' ')
         foreRef = nextRef(foreRef);
 
     // look for next lst-link in both directions
@@ -866,6 +943,10 @@ void MemoryMapper::internalRemoveChunk(int chunkNr)
     }
     if (delUnit >= 0)
         mUnits.remove(delUnit);
+    // forget spilled data of the chunk
+    mPagedChunks.removeAll(chunk);
+    if (mSpillPos.remove(chunk) && mSpillPos.isEmpty() && mSpillFile.isOpen())
+        mSpillFile.resize(0);
     // remove chunk and adjust chunk-numbers
     mChunks.removeAt(chunkNr);
     for (int i = chunkNr; i < mChunks.size(); ++i) {
@@ -889,7 +970,7 @@ AbstractTextMapper::Chunk *MemoryMapper::getChunk(int chunkNr, bool cache) const
 {
     Q_UNUSED(cache)
     if (chunkNr >= 0 && mChunks.size() > chunkNr)
-        return mChunks.at(chunkNr);
+        return pageIn(mChunks.at(chunkNr));
     return nullptr;
 }
 
@@ -922,6 +1003,7 @@ MemoryMapper::LineRef MemoryMapper::prevRef(const MemoryMapper::LineRef &ref)
 QByteArray MemoryMapper::lineData(const MemoryMapper::LineRef &ref)
 {
     if (!ref.chunk) return QByteArray();
+    pageIn(ref.chunk);
     int byteFrom = ref.chunk->lineBytes.at(ref.relLine);
     int byteTo = ref.chunk->lineBytes.at(ref.relLine+1);
     while ((ref.chunk->bArray.at(byteTo) == '\n' || ref.chunk->bArray.at(byteTo) == '\r') && byteTo > byteFrom)
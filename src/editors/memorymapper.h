@@ -25,6 +25,7 @@
 #include <QMutex>
 #include <QTimer>
 #include <QElapsedTimer>
+#include <QTemporaryFile>
 
 namespace gams {
 namespace studio {
@@ -136,6 +137,10 @@ private: // methods
     LineRef prevRef(const LineRef &ref);
     QByteArray lineData(const LineRef &ref);
     Chunk *addChunk(bool startUnit = false);
+    void spillChunks();
+    bool spillChunk(Chunk *chunk);
+    Chunk *pageIn(Chunk *chunk) const;
+    void clearSpill();
     void shrinkLog(qint64 minBytes);
     bool ensureSpace(qint64 bytes);
     void recalcLineCount();
@@ -174,6 +179,11 @@ private: // members
     QTimer mPendingTimer;
     int mNewLines = 0;
     bool mInstantRefresh = false;
+
+    mutable QTemporaryFile mSpillFile;      // holds the data of chunks that have been spilled to disk
+    QHash<const Chunk*, qint64> mSpillPos;  // start of the chunk data in the spill file
+    mutable QVector<Chunk*> mPagedChunks;   // spilled chunks that are currently paged in
+    bool mSpillFailed = false;
 };
 
 } // namespace studio
@@ -0,0 +1,267 @@
+/*
+ * This file is part of the GAMS Studio project.
+ *
+ * Copyright (c) 2017-2020 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2020 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "filechangewatcher.h"
+#include <QtConcurrent>
+#include <QFileInfo>
+
+namespace gams {
+namespace studio {
+
+FileChangeWatcher::FileChangeWatcher(QObject *parent) : QObject(parent)
+{
+    connect(&mWatcher, &QFileSystemWatcher::directoryChanged, this, &FileChangeWatcher::directoryChanged);
+    connect(&mWatcher, &QFileSystemWatcher::fileChanged, this, &FileChangeWatcher::fileChanged);
+    mBatchTimer.setInterval(CBatchDelay);
+    mBatchTimer.setSingleShot(true);
+    connect(&mBatchTimer, &QTimer::timeout, this, &FileChangeWatcher::scanPending);
+    mPollTimer.setSingleShot(true);
+    connect(&mPollTimer, &QTimer::timeout, this, &FileChangeWatcher::poll);
+    connect(&mScan, &QFutureWatcher<Fingerprints>::finished, this, &FileChangeWatcher::scanFinished);
+}
+
+FileChangeWatcher::~FileChangeWatcher()
+{
+    mScan.waitForFinished();
+}
+
+bool FileChangeWatcher::watch(const QString &filePath, bool open)
+{
+    if (filePath.isEmpty()) return false;
+    // (re-)watching takes the current state as reference, a running scan result for this file is outdated
+    Fingerprint print = fingerprint(filePath);
+    mScanning.remove(filePath);
+    if (!mFingerprints.contains(filePath)) {
+        QString dir = QFileInfo(filePath).absolutePath();
+        QSet<QString> &files = mDirFiles[dir];
+        files.insert(filePath);
+        if (files.size() == 1) watchDirectory(dir);
+    }
+    mFingerprints.insert(filePath, print);
+    setOpen(filePath, open);
+    return print.exists;
+}
+
+void FileChangeWatcher::unwatch(const QString &filePath)
+{
+    if (!mFingerprints.remove(filePath)) return;
+    QString dir = QFileInfo(filePath).absolutePath();
+    auto it = mDirFiles.find(dir);
+    if (it != mDirFiles.end()) {
+        it->remove(filePath);
+        if (it->isEmpty()) {
+            mDirFiles.erase(it);
+            if (!mPolledDirs.remove(dir)) mWatcher.removePath(dir);
+        }
+    }
+    if (mOpenFiles.remove(filePath) && mWatcher.files().contains(filePath))
+        mWatcher.removePath(filePath);
+    mPending.remove(filePath);
+    mScanning.remove(filePath);
+    updatePolling();
+}
+
+void FileChangeWatcher::setOpen(const QString &filePath, bool open)
+{
+    if (!mFingerprints.contains(filePath)) return;
+    if (open) {
+        if (!mOpenFiles.contains(filePath)) {
+            mOpenFiles.insert(filePath);
+            watchFile(filePath);
+        }
+    } else if (mOpenFiles.remove(filePath) && mWatcher.files().contains(filePath)) {
+        mWatcher.removePath(filePath);
+    }
+    updatePolling();
+}
+
+bool FileChangeWatcher::isWatching(const QString &filePath) const
+{
+    return mFingerprints.contains(filePath);
+}
+
+bool FileChangeWatcher::hasFileWatch(const QString &filePath) const
+{
+    return mWatcher.files().contains(filePath);
+}
+
+bool FileChangeWatcher::isPolling() const
+{
+    return mPolling;
+}
+
+void FileChangeWatcher::directoryChanged(const QString &path)
+{
+    const QSet<QString> files = mDirFiles.value(path);
+    if (files.isEmpty()) return;
+    if (!QFileInfo(path).isDir()) {
+        // the system drops the watch of a removed directory, poll until it reappears
+        if (mWatcher.directories().contains(path)) mWatcher.removePath(path);
+        mPolledDirs.insert(path);
+        updatePolling();
+    }
+    for (const QString &file : files)
+        addPending(file);
+}
+
+void FileChangeWatcher::fileChanged(const QString &path)
+{
+    if (mFingerprints.contains(path)) addPending(path);
+}
+
+void FileChangeWatcher::addPending(const QString &filePath)
+{
+    mPending.insert(filePath);
+    // not restarted on further events: continuously written files (e.g. logs) are still checked regularly
+    if (!mBatchTimer.isActive()) mBatchTimer.start();
+}
+
+void FileChangeWatcher::scanPending()
+{
+    if (mScan.isRunning()) return;
+    if (mPending.isEmpty()) {
+        // all files of a poll have been unwatched meanwhile
+        if (mPolling) {
+            mPolling = false;
+            updatePolling();
+        }
+        return;
+    }
+    mScanning = mPending;
+    mPending.clear();
+    mScan.setFuture(QtConcurrent::run(&FileChangeWatcher::fingerprints, mScanning.values()));
+}
+
+void FileChangeWatcher::scanFinished()
+{
+    const Fingerprints prints = mScan.result();
+    QStringList changed;
+    QStringList removed;
+    QStringList appeared;
+    QStringList rewatch;
+    for (auto it = prints.constBegin(); it != prints.constEnd(); ++it) {
+        // skip files that have been unwatched or re-watched meanwhile
+        if (!mScanning.contains(it.key())) continue;
+        // an atomic rewrite (write to a temporary file and rename it) drops the file watch, even if the
+        // fingerprint stays the same
+        if (it->exists && mOpenFiles.contains(it.key())) rewatch << it.key();
+        auto known = mFingerprints.find(it.key());
+        if (known == mFingerprints.end() || *known == it.value()) continue;
+        if (!it->exists) removed << it.key();
+        else if (!known->exists) appeared << it.key();
+        else changed << it.key();
+        *known = it.value();
+    }
+    mScanning.clear();
+    for (const QString &filePath : rewatch)
+        watchFile(filePath);
+    if (mPolling) {
+        mPolling = false;
+        bool found = !changed.isEmpty() || !removed.isEmpty() || !appeared.isEmpty();
+        mPollInterval = found ? CMinPollInterval : qMin(mPollInterval * 2, CMaxPollInterval);
+    }
+    updatePolling();
+    if (!mPending.isEmpty() && !mBatchTimer.isActive()) mBatchTimer.start();
+
+    if (!removed.isEmpty()) emit filesRemoved(removed);
+    if (!appeared.isEmpty()) emit filesAppeared(appeared);
+    if (!changed.isEmpty()) emit filesChanged(changed);
+}
+
+void FileChangeWatcher::poll()
+{
+    const QStringList files = pollCandidates();
+    const QSet<QString> dirs = mPolledDirs;
+    for (const QString &dir : dirs) {
+        if (QFileInfo(dir).isDir() && mWatcher.addPath(dir)) mPolledDirs.remove(dir);
+    }
+    if (files.isEmpty()) return;
+    mPolling = true;
+    for (const QString &file : files)
+        addPending(file);
+}
+
+QStringList FileChangeWatcher::pollCandidates() const
+{
+    QStringList res;
+    for (const QString &dir : mPolledDirs)
+        res << mDirFiles.value(dir).values();
+    if (mOpenFiles.isEmpty()) return res;
+    const QStringList watchedFiles = mWatcher.files();
+    for (const QString &file : mOpenFiles) {
+        if (!watchedFiles.contains(file) && !mPolledDirs.contains(QFileInfo(file).absolutePath()))
+            res << file;
+    }
+    return res;
+}
+
+void FileChangeWatcher::updatePolling()
+{
+    if (pollCandidates().isEmpty()) {
+        mPollTimer.stop();
+        mPollInterval = CMinPollInterval;
+    } else if (!mPollTimer.isActive() && !mPolling) {
+        mPollTimer.start(mPollInterval);
+    }
+}
+
+void FileChangeWatcher::watchDirectory(const QString &dir)
+{
+    if (QFileInfo(dir).isDir() && mWatcher.addPath(dir))
+        mPolledDirs.remove(dir);
+    else
+        mPolledDirs.insert(dir);
+}
+
+void FileChangeWatcher::watchFile(const QString &filePath)
+{
+    // beyond the limit (or if the system refuses the watch) the file is polled
+    const QStringList watchedFiles = mWatcher.files();
+    if (watchedFiles.size() >= CMaxFileWatches || watchedFiles.contains(filePath)) return;
+    if (QFileInfo::exists(filePath)) mWatcher.addPath(filePath);
+}
+
+FileChangeWatcher::Fingerprint FileChangeWatcher::fingerprint(const QString &filePath)
+{
+    Fingerprint res;
+    QFileInfo fi(filePath);
+    res.exists = fi.exists();
+    if (res.exists) {
+        res.size = fi.size();
+        res.modified = fi.lastModified();
+    }
+    return res;
+}
+
+FileChangeWatcher::Fingerprints FileChangeWatcher::fingerprints(const QStringList &filePaths)
+{
+    Fingerprints res;
+    res.reserve(filePaths.size());
+    for (const QString &filePath : filePaths)
+        res.insert(filePath, fingerprint(filePath));
+    return res;
+}
+
+bool FileChangeWatcher::Fingerprint::operator==(const FileChangeWatcher::Fingerprint &other) const
+{
+    return exists == other.exists && size == other.size && modified == other.modified;
+}
+
+} // namespace studio
+} // namespace gams
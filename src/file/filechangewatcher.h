@@ -0,0 +1,107 @@
+/*
+ * This file is part of the GAMS Studio project.
+ *
+ * Copyright (c) 2017-2020 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2020 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef FILECHANGEWATCHER_H
+#define FILECHANGEWATCHER_H
+
+#include <QObject>
+#include <QFileSystemWatcher>
+#include <QFutureWatcher>
+#include <QDateTime>
+#include <QTimer>
+#include <QHash>
+#include <QSet>
+
+namespace gams {
+namespace studio {
+
+///
+/// \brief The FileChangeWatcher detects external changes of the files known to the FileMetaRepo.
+/// \details Instead of one system watch per file the parent directories are watched. Directory events are
+/// collected for a short delay and the size/mtime fingerprints of the affected files are computed on a worker
+/// thread. Open files additionally get a file watch (up to CMaxFileWatches) to catch in-place writes.
+/// Directories that can't be watched and open files without file watch are polled with an adaptive interval.
+///
+class FileChangeWatcher : public QObject
+{
+    Q_OBJECT
+public:
+    explicit FileChangeWatcher(QObject *parent = nullptr);
+    ~FileChangeWatcher() override;
+    bool watch(const QString &filePath, bool open = false);
+    void unwatch(const QString &filePath);
+    void setOpen(const QString &filePath, bool open);
+    bool isWatching(const QString &filePath) const;
+    bool hasFileWatch(const QString &filePath) const;
+    bool isPolling() const;
+
+signals:
+    void filesChanged(const QStringList &filePaths);
+    void filesRemoved(const QStringList &filePaths);
+    void filesAppeared(const QStringList &filePaths);
+
+private slots:
+    void directoryChanged(const QString &path);
+    void fileChanged(const QString &path);
+    void scanPending();
+    void scanFinished();
+    void poll();
+
+private:
+    struct Fingerprint {
+        bool exists = false;
+        qint64 size = 0;
+        QDateTime modified;
+        bool operator==(const Fingerprint &other) const;
+        bool operator!=(const Fingerprint &other) const { return !(*this == other); }
+    };
+    typedef QHash<QString, Fingerprint> Fingerprints;
+
+    static Fingerprint fingerprint(const QString &filePath);
+    static Fingerprints fingerprints(const QStringList &filePaths);
+    void watchDirectory(const QString &dir);
+    void watchFile(const QString &filePath);
+    void addPending(const QString &filePath);
+    QStringList pollCandidates() const;
+    void updatePolling();
+
+private:
+    static const int CBatchDelay = 100;         // ms to collect events before scanning
+    static const int CMinPollInterval = 1000;   // ms
+    static const int CMaxPollInterval = 30000;  // ms
+    static const int CMaxFileWatches = 256;     // file watches for open files
+
+    QFileSystemWatcher mWatcher;
+    QHash<QString, QSet<QString>> mDirFiles;    // watched directory -> tracked files
+    QSet<QString> mPolledDirs;                  // directories without change notification
+    QSet<QString> mOpenFiles;
+    Fingerprints mFingerprints;
+    QSet<QString> mPending;
+    QSet<QString> mScanning;
+    QTimer mBatchTimer;
+    QTimer mPollTimer;
+    int mPollInterval = CMinPollInterval;
+    bool mPolling = false;
+    QFutureWatcher<Fingerprints> mScan;
+};
+
+} // namespace studio
+} // namespace gams
+
+#endif // FILECHANGEWATCHER_H
@@ -39,10 +39,15 @@
 #include <QPlainTextDocumentLayout>
 #include <QTextCodec>
 #include <QScrollBar>
+#include <QtConcurrent>
 
 namespace gams {
 namespace studio {
 
+static const qint64 CStagedLoadSize = 8*1024*1024;  // files from this size on are loaded in stages
+static const int CLoadPartSize = 256*1024;          // bytes read and decoded for each stage
+static const int CLoadPartsQueued = 64;             // count of decoded parts until the reading thread waits
+
 FileMeta::FileMeta(FileMetaRepo *fileRepo, FileId id, QString location, FileType *knownType)
     : mId(id), mFileRepo(fileRepo), mData(Data(location, knownType))
 {
@@ -57,6 +62,8 @@ FileMeta::FileMeta(FileMetaRepo *fileRepo, FileId id, QString location, FileType
     connect(&mReloadTimer, &QTimer::timeout, this, &FileMeta::reload);
     mDirtyLinesUpdater.setSingleShot(true);
     connect(&mDirtyLinesUpdater, &QTimer::timeout, this, &FileMeta::updateMarks);
+    mLoadTimer.setInterval(1);
+    connect(&mLoadTimer, &QTimer::timeout, this, &FileMeta::loadNextPart);
 }
 
 void FileMeta::setLocation(QString location)
@@ -199,6 +206,7 @@ void FileMeta::unlinkAndFreeDocument()
         mHighlighter->deleteLater();
         mHighlighter = nullptr;
     }
+    abortStagedLoad();
     mDocument->deleteLater();
     mDocument = nullptr;
 }
@@ -293,6 +301,10 @@ void FileMeta::contentsChange(int from, int charsRemoved, int charsAdded)
 
 void FileMeta::blockCountChanged(int newBlockCount)
 {
+    if (mLoadState) { // the document is filled in stages, there are no marks to shift
+        mLineCount = newBlockCount;
+        return;
+    }
     if (mLineCount != newBlockCount) {
         mFileRepo->textMarkRepo()->shiftMarks(id(), mChangedLine, newBlockCount-mLineCount);
         mLineCount = newBlockCount;
@@ -303,14 +315,16 @@ void FileMeta::updateMarks()
 {
     QMutexLocker mx(&mDirtyLinesMutex);
 
-    // update changed editors
+    // update changed editors, an empty set stands for a complete change
+    const QSet<int> dirtyLines = mAllLinesDirty ? QSet<int>() : mDirtyLines;
     for (QWidget *w: mEditors) {
         if (AbstractEdit * ed = ViewHelper::toAbstractEdit(w))
-            ed->marksChanged(mDirtyLines);
+            ed->marksChanged(dirtyLines);
         if (TextView * tv = ViewHelper::toTextView(w))
-            tv->marksChanged(mDirtyLines);
+            tv->marksChanged(dirtyLines);
     }
     mDirtyLines.clear();
+    mAllLinesDirty = false;
 }
 
 void FileMeta::reload()
@@ -390,6 +404,7 @@ void FileMeta::addEditor(QWidget *edit)
         EXCEPT() << "Type assignment missing for this editor/viewer";
 
     mEditors.prepend(edit);
+    if (mEditors.size() == 1) mFileRepo->updateOpenState(this);
     initEditorColors();
     ViewHelper::setLocation(edit, location());
     ViewHelper::setFileId(edit, id());
@@ -400,6 +415,8 @@ void FileMeta::addEditor(QWidget *edit)
             linkDocument(aEdit->document());
         else
             aEdit->setDocument(mDocument);
+        if (mLoadState)
+            setEditsLoading(true);
         connect(aEdit, &AbstractEdit::requestLstTexts, mFileRepo->projectRepo(), &ProjectRepo::errorTexts);
         connect(aEdit, &AbstractEdit::toggleBookmark, mFileRepo, &FileMetaRepo::toggleBookmark);
         connect(aEdit, &AbstractEdit::jumpToNextBookmark, mFileRepo, &FileMetaRepo::jumpToNextBookmark);
@@ -445,6 +462,7 @@ void FileMeta::removeEditor(QWidget *edit)
     AbstractEdit* aEdit = ViewHelper::toAbstractEdit(edit);
     CodeEdit* scEdit = ViewHelper::toCodeEdit(edit);
     mEditors.removeAt(i);
+    if (mEditors.isEmpty()) mFileRepo->updateOpenState(this);
 
     if (aEdit) {
         aEdit->setMarks(nullptr);
@@ -493,6 +511,7 @@ void FileMeta::load(int codecMib, bool init)
     if (codecMib == -1) {
         codecMib = Settings::settings()->toInt(skDefaultCodecMib);
     }
+    abortStagedLoad();
     mCodec = QTextCodec::codecForMib(codecMib);
     mData = Data(location(), mData.type);
 
@@ -561,10 +580,16 @@ void FileMeta::load(int codecMib, bool init)
         if (!file.open(QFile::ReadOnly | QFile::Text))
             EXCEPT() << "Error opening file " << location();
 
+        QTextCodec *codec = QTextCodec::codecForMib(codecMib);
+        if (codec && file.size() >= CStagedLoadSize) {
+            qint64 size = file.size();
+            file.close();
+            loadStaged(codec, size);
+            return;
+        }
         const QByteArray data(file.readAll());
         QString invalidCodecs;
         QTextCodec::ConverterState state;
-        QTextCodec *codec = QTextCodec::codecForMib(codecMib);
         if (codec) {
             QString text = codec->toUnicode(data.constData(), data.size(), &state);
             if (state.invalidChars != 0) {
@@ -592,6 +617,127 @@ void FileMeta::load(int codecMib, bool init)
     return;
 }
 
+void FileMeta::loadStaged(QTextCodec *codec, qint64 size)
+{
+    // The file is read and decoded in a separate thread while the document is filled part by part. The
+    // highlighter is paused until the document is complete.
+    mLoadState = QSharedPointer<LoadState>::create();
+    mLoadState->size = size;
+    mLoadEditPositions = getEditPositions();
+    mLoading = true;
+    mCodec = codec;
+    if (mHighlighter) mHighlighter->pause();
+    setEditsLoading(true);
+    document()->setUndoRedoEnabled(false);
+    document()->clear();
+    emit loadAmountChanged(id(), 0.0);
+    QtConcurrent::run(&FileMeta::readStaged, location(), codec, mLoadState);
+    mLoadTimer.start();
+}
+
+void FileMeta::readStaged(QString location, QTextCodec *codec, QSharedPointer<LoadState> state)
+{
+    QFile file(location);
+    bool ok = file.open(QFile::ReadOnly | QFile::Text);
+    QScopedPointer<QTextDecoder> decoder(codec->makeDecoder());
+    while (ok && !file.atEnd()) {
+        const QByteArray data = file.read(CLoadPartSize);
+        if (data.isEmpty()) break;
+        QString text = decoder->toUnicode(data);
+        QMutexLocker locker(&state->mutex);
+        // the queue is bounded, the document may be filled slower than the file is read
+        while (!state->aborted && state->parts.size() >= CLoadPartsQueued)
+            state->partTaken.wait(&state->mutex);
+        if (state->aborted) return;
+        state->parts << text;
+        state->partEnds << file.pos();
+        if (decoder->hasFailure()) state->invalidChars = true;
+    }
+    QMutexLocker locker(&state->mutex);
+    state->done = true;
+}
+
+void FileMeta::loadNextPart()
+{
+    if (!mLoadState || !mDocument) return;
+    QString text;
+    bool done = false;
+    {
+        QMutexLocker locker(&mLoadState->mutex);
+        if (!mLoadState->parts.isEmpty()) {
+            text = mLoadState->parts.takeFirst();
+            mLoadState->filled = mLoadState->partEnds.takeFirst();
+            mLoadState->partTaken.wakeOne();
+        }
+        done = mLoadState->done && mLoadState->parts.isEmpty();
+    }
+    if (!text.isEmpty()) {
+        QTextCursor cursor(mDocument);
+        cursor.movePosition(QTextCursor::End);
+        cursor.insertText(text);
+        if (mLoadState->size > 0)
+            emit loadAmountChanged(id(), qreal(mLoadState->filled) / mLoadState->size);
+    }
+    if (done) finishStagedLoad();
+}
+
+void FileMeta::finishStagedLoad()
+{
+    mLoadTimer.stop();
+    bool invalidChars = mLoadState->invalidChars;
+    mLoadState.reset();
+    mDocument->setUndoRedoEnabled(true);
+    setEditsLoading(false);
+    if (mHighlighter) mHighlighter->resume();
+    setEditPositions(mLoadEditPositions);
+    mLoadEditPositions.clear();
+    mLoading = false;
+    if (invalidChars) {
+        DEB() << location() << " contains characters that can't be decoded with " << mCodec->name();
+    }
+    setModified(false);
+    emit loadAmountChanged(id(), 1.0);
+}
+
+void FileMeta::abortStagedLoad()
+{
+    if (!mLoadState) return;
+    {
+        QMutexLocker locker(&mLoadState->mutex);
+        mLoadState->aborted = true;
+        mLoadState->partTaken.wakeAll();
+    }
+    mLoadState.reset();
+    mLoadTimer.stop();
+    mLoadEditPositions.clear();
+    setEditsLoading(false);
+    if (mDocument) mDocument->setUndoRedoEnabled(true);
+    if (mHighlighter) mHighlighter->resume();
+    mLoading = false;
+    emit loadAmountChanged(id(), 1.0);
+}
+
+void FileMeta::setEditsLoading(bool loading)
+{
+    // editors are read-only while the document is filled
+    for (QWidget *wid: mEditors) {
+        AbstractEdit *edit = ViewHelper::toAbstractEdit(wid);
+        if (!edit) continue;
+        if (loading && !edit->isReadOnly()) {
+            edit->setReadOnly(true);
+            edit->setProperty("loading", true);
+        } else if (!loading && edit->property("loading").toBool()) {
+            edit->setReadOnly(false);
+            edit->setProperty("loading", QVariant());
+        }
+    }
+}
+
+bool FileMeta::isLoading() const
+{
+    return !mLoadState.isNull();
+}
+
 void FileMeta::save(const QString &newLocation)
 {
     QString location = newLocation.isEmpty() ? mLocation : newLocation;
@@ -600,6 +746,8 @@ void FileMeta::save(const QString &newLocation)
 
     if (location.isEmpty() || location.startsWith('['))
         EXCEPT() << "Can't save file '" << location << "'";
+    if (isLoading())
+        EXCEPT() << "Can't save file '" << location << "' while it is loaded";
 
     if (document()) {
         mActivelySaved = true;
@@ -722,7 +870,9 @@ syntax::SyntaxHighlighter *FileMeta::highlighter() const
 void FileMeta::marksChanged(QSet<int> lines)
 {
     QMutexLocker mx(&mDirtyLinesMutex);
-    mDirtyLines.unite(lines);
+    // an empty set marks all lines as dirty, this must not get lost when merged with pending lines
+    if (lines.isEmpty()) mAllLinesDirty = true;
+    else if (!mAllLinesDirty) mDirtyLines.unite(lines);
     if (lines.isEmpty()) mDirtyLinesUpdater.start(0);
     else if (!mDirtyLinesUpdater.isActive()) mDirtyLinesUpdater.start(500);
 }
@@ -929,6 +1079,8 @@ QWidget* FileMeta::createEdit(QTabWidget *tabWidget, ProjectRunGroupNode *runGro
         } else {
             connect(codeEdit, &CodeEdit::hasHRef, runGroup, &ProjectRunGroupNode::hasHRef);
             connect(codeEdit, &CodeEdit::jumpToHRef, runGroup, &ProjectRunGroupNode::jumpToHRef);
+            connect(codeEdit, &CodeEdit::hasDeclaration, runGroup, &ProjectRunGroupNode::hasDeclaration);
+            connect(codeEdit, &CodeEdit::jumpToDeclaration, runGroup, &ProjectRunGroupNode::jumpToDeclaration);
         }
     }
     ViewHelper::setFileId(res, id());
@@ -24,6 +24,8 @@
 #include <QDateTime>
 #include <QTextDocument>
 #include <QTableView>
+#include <QSharedPointer>
+#include <QWaitCondition>
 #include "syntax.h"
 #include "editors/codeedit.h"
 #include "editors/processlogedit.h"
@@ -73,6 +75,7 @@ public:
     bool isOpen() const;
     bool isModified() const;
     bool isReadOnly() const;
+    bool isLoading() const;
     bool isAutoReload() const;
     void resetTempReloadState();
     void setModified(bool modified=true);
@@ -112,12 +115,14 @@ signals:
     void documentOpened();
     void documentClosed();
     void editableFileSizeCheck(const QFile &file, bool &canOpen);
+    void loadAmountChanged(FileId fileId, qreal amount);
 
 private slots:
     void modificationChanged(bool modiState);
     void contentsChange(int from, int charsRemoved, int charsAdded);
     void blockCountChanged(int newBlockCount);
     void updateMarks();
+    void loadNextPart();
 
 private:
     struct Data {
@@ -130,6 +135,18 @@ private:
         FileType *type = nullptr;
     };
 
+    struct LoadState {  // shared between the reading thread and the staged filling of the document
+        QMutex mutex;
+        QWaitCondition partTaken;   // wakes the reading thread when the queue is full
+        QStringList parts;
+        QVector<qint64> partEnds;
+        qint64 size = 0;
+        qint64 filled = 0;
+        bool done = false;
+        bool aborted = false;
+        bool invalidChars = false;
+    };
+
     friend class FileMetaRepo;
     FileMeta(FileMetaRepo* fileRepo, FileId id, QString location, FileType *knownType = nullptr);
     QVector<QPoint> getEditPositions();
@@ -141,6 +158,11 @@ private:
     void initEditorColors();
     void updateEditorColors();
     void addEditor(QWidget* edit);
+    void loadStaged(QTextCodec *codec, qint64 size);
+    void finishStagedLoad();
+    void abortStagedLoad();
+    void setEditsLoading(bool loading);
+    static void readStaged(QString location, QTextCodec *codec, QSharedPointer<LoadState> state);
 
 private:
     FileId mId;
@@ -160,7 +182,11 @@ private:
     QTimer mReloadTimer;
     QTimer mDirtyLinesUpdater;
     QSet<int> mDirtyLines;
+    bool mAllLinesDirty = false;
     QMutex mDirtyLinesMutex;
+    QSharedPointer<LoadState> mLoadState;
+    QVector<QPoint> mLoadEditPositions;
+    QTimer mLoadTimer;
 };
 
 } // namespace studio
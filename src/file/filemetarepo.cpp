@@ -24,6 +24,7 @@
 #include "settings.h"
 #include "exception.h"
 #include "logger.h"
+#include "diagnostics.h"
 #include "viewhelper.h"
 #include <QFileInfo>
 
@@ -32,11 +33,9 @@ namespace studio {
 
 FileMetaRepo::FileMetaRepo(QObject *parent) : QObject(parent)
 {
-//    connect(&mWatcher, &QFileSystemWatcher::directoryChanged, this, &FileMetaRepo::dirChanged);
-    connect(&mWatcher, &QFileSystemWatcher::fileChanged, this, &FileMetaRepo::fileChanged);
-    mMissCheckTimer.setInterval(5000);
-    mMissCheckTimer.setSingleShot(true);
-    connect(&mMissCheckTimer, &QTimer::timeout, this, &FileMetaRepo::checkMissing);
+    connect(&mChangeWatcher, &FileChangeWatcher::filesChanged, this, &FileMetaRepo::filesChanged);
+    connect(&mChangeWatcher, &FileChangeWatcher::filesRemoved, this, &FileMetaRepo::filesRemoved);
+    connect(&mChangeWatcher, &FileChangeWatcher::filesAppeared, this, &FileMetaRepo::filesAppeared);
     mSettings = Settings::settings();
 }
 
@@ -181,28 +180,24 @@ QWidgetList FileMetaRepo::editors() const
 void FileMetaRepo::unwatch(const FileMeta *fileMeta)
 {
     if (fileMeta->location().isEmpty()) return;
-    mWatcher.removePath(fileMeta->location());
-    mMissList.removeAll(fileMeta->location());
-    if (mMissList.isEmpty()) mMissCheckTimer.stop();
+    mChangeWatcher.unwatch(fileMeta->location());
 }
 
 void FileMetaRepo::unwatch(const QString &filePath)
 {
     if (filePath.isEmpty()) return;
-    mWatcher.removePath(filePath);
-    mMissList.removeAll(filePath);
-    if (mMissList.isEmpty()) mMissCheckTimer.stop();
+    mChangeWatcher.unwatch(filePath);
 }
 
 bool FileMetaRepo::watch(const FileMeta *fileMeta)
 {
-    if (fileMeta->exists(true)) {
-        mWatcher.addPath(fileMeta->location());
-        return true;
-    }
-    mMissList << fileMeta->location();
-    if (!mMissCheckTimer.isActive()) mMissCheckTimer.start();
-    return false;
+    return mChangeWatcher.watch(fileMeta->location(), fileMeta->isOpen());
+}
+
+void FileMetaRepo::updateOpenState(const FileMeta *fileMeta)
+{
+    // open files are checked more closely for in-place changes
+    mChangeWatcher.setOpen(fileMeta->location(), fileMeta->isOpen());
 }
 
 void FileMetaRepo::setDebugMode(bool debug)
@@ -247,76 +242,50 @@ void FileMetaRepo::openFile(FileMeta *fm, NodeId groupId, bool focus, int codecM
     emit mProjectRepo->openFile(fm, focus, runGroup, codecMib);
 }
 
-void FileMetaRepo::fileChanged(const QString &path)
+void FileMetaRepo::filesChanged(const QStringList &paths)
 {
-    FileMeta *file = fileMeta(path);
-    if (!file) return;
-    mProjectRepo->fileChanged(file->id());
-    QFileInfo fi(path);
-    if (!fi.exists()) {
-        // deleted: delayed check to ensure it's not just rewritten (or renamed)
-        mRemoved << path;
-        QTimer::singleShot(100, this, &FileMetaRepo::reviewRemoved);
-    } else {
-        // changedExternally
-        if (file->compare(path)) {
-            FileEvent e(file->id(), FileEventKind::changedExtern);
+    DIAGNOSE("project repo")
+    for (const QString &path : paths) {
+        FileMeta *file = fileMeta(path);
+        if (!file) continue;
+        mProjectRepo->fileChanged(file->id());
+        if (file->compare()) {
+            FileEventKind feKind = file->checkActivelySavedAndReset() ? FileEventKind::changed
+                                                                      : FileEventKind::changedExtern;
+            FileEvent e(file->id(), feKind);
             file->updateView();
             emit fileEvent(e);
         }
     }
 }
 
-void FileMetaRepo::reviewRemoved()
+void FileMetaRepo::filesRemoved(const QStringList &paths)
 {
-    while (!mRemoved.isEmpty()) {
-        FileMeta *file = fileMeta(mRemoved.takeFirst());
+    // The FileChangeWatcher reports deletions after a short delay, so files that are just rewritten by
+    // renaming a temporary file arrive as changed instead.
+    // (JM) About RENAME: To evaluate if a file has been renamed the directory content before the
+    // change must have been stored so it can be ensured that the possible file is no recent copy
+    // of the file that was removed.
+    for (const QString &path : paths) {
+        FileMeta *file = fileMeta(path);
         if (!file) continue;
         mProjectRepo->fileChanged(file->id());
-        if (watch(file)) {
-            FileMeta::FileDifferences diff = file->compare();
-            if (diff.testFlag(FileMeta::FdMissing)) {
-                FileEvent e(file->id(), FileEventKind::removedExtern);
-                emit fileEvent(e);
-            } else if (diff) {
-                FileEventKind feKind = file->checkActivelySavedAndReset() ? FileEventKind::changed
-                                                                          : FileEventKind::changedExtern;
-                FileEvent e(file->id(), feKind);
-                file->updateView();
-                emit fileEvent(e);
-            }
-        } else {
-            // (JM) About RENAME: To evaluate if a file has been renamed the directory content before the
-            // change must have been stored so it can be ensured that the possible file is no recent copy
-            // of the file that was removed.
-            FileEvent e(file->id(), FileEventKind::removedExtern);
-            emit fileEvent(e);
-        }
+        FileEvent e(file->id(), FileEventKind::removedExtern);
+        emit fileEvent(e);
     }
 }
 
-void FileMetaRepo::checkMissing()
+void FileMetaRepo::filesAppeared(const QStringList &paths)
 {
-    QStringList remainMissList;
-    while (!mMissList.isEmpty()) {
-        QString fileName = mMissList.takeFirst();
-        FileMeta *file = fileMeta(fileName);
+    for (const QString &path : paths) {
+        FileMeta *file = fileMeta(path);
         if (!file) continue;
         mProjectRepo->fileChanged(file->id());
-        if (QFileInfo(fileName).exists()) {
-            watch(file);
-            FileEventKind feKind = file->checkActivelySavedAndReset() ? FileEventKind::changed
-                                                                      : FileEventKind::changedExtern;
-            FileEvent e(file->id(), feKind);
-            file->updateView();
-            emit fileEvent(e);
-        } else {
-            remainMissList << fileName;
-        }
-    }
-    if (!remainMissList.isEmpty()) {
-        mMissList = remainMissList;
-        mMissCheckTimer.start();
+        FileEventKind feKind = file->checkActivelySavedAndReset() ? FileEventKind::changed
+                                                                  : FileEventKind::changedExtern;
+        FileEvent e(file->id(), feKind);
+        file->updateView();
+        emit fileEvent(e);
     }
 }
 
@@ -337,6 +306,7 @@ FileMeta* FileMetaRepo::findOrCreateFileMeta(QString location, FileType *knownTy
     if (!res) {
         res = new FileMeta(this, mNextFileId++, location, knownType);
         connect(res, &FileMeta::editableFileSizeCheck, this, &FileMetaRepo::editableFileSizeCheck);
+        connect(res, &FileMeta::loadAmountChanged, this, &FileMetaRepo::loadAmountChanged);
         addFileMeta(res);
     }
     return res;
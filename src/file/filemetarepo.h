@@ -21,8 +21,8 @@
 #define FILEMETAREPO_H
 
 #include <QObject>
-#include <QFileSystemWatcher>
 #include "filemeta.h"
+#include "filechangewatcher.h"
 #include "fileevent.h"
 #include "common.h"
 
@@ -51,6 +51,7 @@ public:
     void unwatch(const FileMeta* fm);
     void unwatch(const QString &filePath);
     bool watch(const FileMeta* fm);
+    void updateOpenState(const FileMeta* fm);
 
     void setDebugMode(bool debug);
     bool debugMode() const;
@@ -63,6 +64,7 @@ public:
 signals:
     void fileEvent(FileEvent &e);
     void editableFileSizeCheck(const QFile &file, bool &canOpen);
+    void loadAmountChanged(FileId fileId, qreal amount);
 
 public slots:
     void openFile(FileMeta* fm, NodeId groupId, bool focus = true, int codecMib = -1);
@@ -71,9 +73,9 @@ public slots:
     void jumpToNextBookmark(bool back, FileId refFileId, int refLineNr);
 
 private slots:
-    void fileChanged(const QString& path);
-    void reviewRemoved();
-    void checkMissing();
+    void filesChanged(const QStringList &paths);
+    void filesRemoved(const QStringList &paths);
+    void filesAppeared(const QStringList &paths);
 
 private:
     void addFileMeta(FileMeta* fileMeta);
@@ -85,10 +87,7 @@ private:
     ProjectRepo* mProjectRepo = nullptr;
     QHash<FileId, FileMeta*> mFiles;
     QHash<QString, FileMeta*> mFileNames;
-    QFileSystemWatcher mWatcher;
-    QStringList mRemoved; // List to be checked once
-    QStringList mMissList; // List to be checked periodically
-    QTimer mMissCheckTimer;
+    FileChangeWatcher mChangeWatcher;
     bool mAskBigFileEdit = true;
     bool mDebug = false;
 
@@ -0,0 +1,255 @@
+/*
+ * This file is part of the GAMS Studio project.
+ *
+ * Copyright (c) 2017-2020 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2020 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "includegraph.h"
+#include "projectgroupnode.h"
+#include "logger.h"
+#include <QFile>
+#include <QFileInfo>
+#include <QTextStream>
+#include <QRegularExpression>
+#include <QtConcurrent>
+
+namespace gams {
+namespace studio {
+
+IncludeGraph::IncludeGraph(ProjectRunGroupNode *runGroup)
+    : QObject(runGroup), mRunGroup(runGroup)
+{
+    mClock.start();
+    mTimer.setInterval(0);
+    mTimer.setSingleShot(true);
+    connect(&mTimer, &QTimer::timeout, this, &IncludeGraph::processQueue);
+    connect(&mScanner, &QFutureWatcher<ScanResults>::finished, this, &IncludeGraph::scanFinished);
+}
+
+IncludeGraph::~IncludeGraph()
+{
+    mScanner.waitForFinished();
+}
+
+void IncludeGraph::updateFile(const QString &file)
+{
+    enqueue(file);
+}
+
+void IncludeGraph::removeFile(const QString &file)
+{
+    mQueue.removeAll(file);
+    mScanning.removeAll(file);
+    mUnresolved.remove(file);
+    if (mIncludes.remove(file)) emit graphChanged();
+}
+
+void IncludeGraph::fileCreated(const QString &file)
+{
+    Q_UNUSED(file)
+    // the new file may be the target of an include that couldn't be resolved so far
+    invalidatePaths();
+    for (const QString &unresolved : mUnresolved)
+        enqueue(unresolved);
+}
+
+void IncludeGraph::fileRemoved(const QString &file)
+{
+    // the files including the removed file may resolve the include to another directory now
+    invalidatePaths();
+    for (auto it = mIncludes.constBegin(); it != mIncludes.constEnd(); ++it) {
+        if (it.value().contains(file)) enqueue(it.key());
+    }
+    removeFile(file);
+}
+
+bool IncludeGraph::contains(const QString &file) const
+{
+    return mIncludes.contains(file) || mQueue.contains(file) || mScanning.contains(file);
+}
+
+void IncludeGraph::enqueue(const QString &file)
+{
+    if (!mQueue.contains(file)) mQueue << file;
+    if (!mTimer.isActive() && !mScanner.isRunning()) mTimer.start();
+}
+
+QStringList IncludeGraph::includedFiles(const QString &file, bool recurse) const
+{
+    QStringList res = mIncludes.value(file);
+    if (!recurse) return res;
+    // breadth-first, each file is listed once even for cyclic includes
+    for (int i = 0; i < res.size(); ++i) {
+        for (const QString &inc: mIncludes.value(res.at(i))) {
+            if (inc != file && !res.contains(inc)) res << inc;
+        }
+    }
+    return res;
+}
+
+bool IncludeGraph::cachedPath(const QString &key, QString &path) const
+{
+    QHash<QString, CachedPath>::const_iterator it = mPaths.constFind(key);
+    if (it == mPaths.constEnd()) return false;
+    if (mClock.elapsed() - it->time > (it->path.isEmpty() ? CMissTimeout : CHitTimeout)) return false;
+    path = it->path;
+    return true;
+}
+
+void IncludeGraph::cachePath(const QString &key, const QString &path)
+{
+    mPaths.insert(key, CachedPath {path, mClock.elapsed()});
+}
+
+void IncludeGraph::invalidatePaths()
+{
+    mPaths.clear();
+}
+
+QString IncludeGraph::includeFile(const QString &line, int &fileStart, QString &code)
+{
+    static const QRegularExpression rex(QString("(^%1|%1%1)\\s*([\\w]+)\\s*").arg(QRegularExpression::escape("$")));
+    QString res;
+    code = "INC";
+    fileStart = line.length() + 1;
+    QRegularExpressionMatch match = rex.match(line);
+    if (match.captured(2).length() < fileStart) {
+        QChar endChar(' ');
+        QString command = match.captured(2).toUpper();
+        if (command == "INCLUDE") {
+            fileStart = match.capturedEnd();
+            endChar = QChar();
+            res = line.mid(fileStart, line.length()).trimmed();
+        } else if (command.endsWith("INCLUDE")) { // batInclude, sysInclude, libInclude
+            if (command.at(0) != 'B') code = command.left(3);
+            fileStart = match.capturedEnd();
+            res = line.mid(fileStart, line.length()).trimmed();
+        }
+        if (!res.isEmpty()) {
+            if (line.at(fileStart) == '\"') endChar = '\"';
+            if (line.at(fileStart) == '\'') endChar = '\'';
+            if (endChar != QChar()) {
+                int w = (endChar==' ') ? 0 : 1;
+                int end = res.indexOf(endChar, 1) + w;
+                if (end) {
+                    res = res.mid(w, end - 2*w);
+                    fileStart += w;
+                }
+            }
+        }
+    }
+    return res;
+}
+
+QString IncludeGraph::resolveInclude(const QStringList &locations, const QString &rawName)
+{
+    // the locations are absolute, the first one containing the file (or the file with suffix .gms) wins
+    for (const QString &loc : locations) {
+        QString fName = loc + '/' + rawName;
+        QFileInfo file(fName);
+        if (file.exists() && file.isFile()) return fName;
+        file.setFile(fName + ".gms");
+        if (file.exists() && file.isFile()) return fName + ".gms";
+    }
+    return QString();
+}
+
+QString IncludeGraph::pathKey(const QString &code, const QStringList &locations, const QString &rawName)
+{
+    return code + '|' + locations.join('|') + '|' + rawName;
+}
+
+void IncludeGraph::processQueue()
+{
+    if (mScanner.isRunning()) return;
+    if (mQueue.isEmpty()) {
+        emit graphChanged();
+        return;
+    }
+    while (mScanning.size() < CFilesPerScan && !mQueue.isEmpty())
+        mScanning << mQueue.takeFirst();
+    // the include directories depend on the run parameters, which are only accessible in the GUI thread
+    mScanLocations.clear();
+    for (const QString &code : {QString("INC"), QString("SYS"), QString("LIB")})
+        mScanLocations.insert(code, mRunGroup->includeLocations(code));
+    mScanner.setFuture(QtConcurrent::run(&IncludeGraph::scanFiles, mScanning, mScanLocations));
+}
+
+void IncludeGraph::scanFinished()
+{
+    const ScanResults results = mScanner.result();
+    for (const ScanResult &result: results) {
+        // skip files that have been removed while the worker was running
+        if (mScanning.removeAll(result.file)) applyResult(result);
+    }
+    mScanning.clear();
+    if (mQueue.isEmpty()) emit graphChanged();
+    else mTimer.start();
+}
+
+IncludeGraph::ScanResults IncludeGraph::scanFiles(const QStringList &files, const Locations &locations)
+{
+    ScanResults results;
+    results.reserve(files.size());
+    for (const QString &fileName: files) {
+        ScanResult result;
+        result.file = fileName;
+        QFile f(fileName);
+        if (f.open(QFile::ReadOnly | QFile::Text)) {
+            result.readable = true;
+            QTextStream in(&f);
+            while (!in.atEnd()) {
+                QString line = in.readLine();
+                if (!line.contains('$') || !line.contains("include", Qt::CaseInsensitive)) continue;
+                int fileStart;
+                Include inc;
+                inc.rawName = includeFile(line, fileStart, inc.code);
+                if (inc.rawName.isEmpty() || !locations.contains(inc.code)) continue;
+                inc.path = resolveInclude(locations.value(inc.code), inc.rawName);
+                result.includes << inc;
+            }
+            f.close();
+        }
+        results << result;
+    }
+    return results;
+}
+
+void IncludeGraph::applyResult(const ScanResult &result)
+{
+    mUnresolved.remove(result.file);
+    if (!result.readable) {
+        mIncludes.remove(result.file);
+        return;
+    }
+    QStringList includes;
+    for (const Include &inc: result.includes) {
+        // the resolution of the worker also serves the include links of the editors
+        cachePath(pathKey(inc.code, mScanLocations.value(inc.code), inc.rawName), inc.path);
+        if (inc.path.isEmpty()) {
+            mUnresolved << result.file;
+        } else if (!includes.contains(inc.path)) {
+            includes << inc.path;
+            // included files are scanned too
+            if (!mIncludes.contains(inc.path) && !mQueue.contains(inc.path) && !mScanning.contains(inc.path))
+                mQueue << inc.path;
+        }
+    }
+    mIncludes.insert(result.file, includes);
+}
+
+} // namespace studio
+} // namespace gams
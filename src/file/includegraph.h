@@ -0,0 +1,115 @@
+/*
+ * This file is part of the GAMS Studio project.
+ *
+ * Copyright (c) 2017-2020 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2020 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef INCLUDEGRAPH_H
+#define INCLUDEGRAPH_H
+
+#include <QObject>
+#include <QHash>
+#include <QStringList>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QSet>
+#include <QVector>
+#include <QFutureWatcher>
+
+namespace gams {
+namespace studio {
+
+class ProjectRunGroupNode;
+
+///
+/// \brief The IncludeGraph keeps the $include relations of the files of a run group.
+/// \details The files are read and their includes are resolved on a worker thread. Only the include
+/// directories of the run group are collected in the GUI thread before. The graph follows the file events of
+/// the FileMetaRepo: changed files are scanned again, removed files rescan the files including them and new
+/// files rescan the files with unresolved includes. Resolved include paths are cached, so hovering over an
+/// include link doesn't access the disk.
+///
+class IncludeGraph : public QObject
+{
+    Q_OBJECT
+public:
+    explicit IncludeGraph(ProjectRunGroupNode *runGroup);
+    ~IncludeGraph() override;
+
+    void updateFile(const QString &file);
+    void removeFile(const QString &file);
+    void fileCreated(const QString &file);
+    void fileRemoved(const QString &file);
+    bool contains(const QString &file) const;
+    QStringList includedFiles(const QString &file, bool recurse = true) const;
+
+    bool cachedPath(const QString &key, QString &path) const;
+    void cachePath(const QString &key, const QString &path);
+    void invalidatePaths();
+
+    static QString includeFile(const QString &line, int &fileStart, QString &code);
+    static QString resolveInclude(const QStringList &locations, const QString &rawName);
+    static QString pathKey(const QString &code, const QStringList &locations, const QString &rawName);
+
+signals:
+    void graphChanged();
+
+private slots:
+    void processQueue();
+    void scanFinished();
+
+private:
+    struct CachedPath {
+        QString path;               // empty if not resolved
+        qint64 time;
+    };
+    struct Include {
+        QString code;
+        QString rawName;
+        QString path;               // empty if not resolved
+    };
+    struct ScanResult {
+        QString file;
+        bool readable = false;
+        QVector<Include> includes;
+    };
+    typedef QVector<ScanResult> ScanResults;
+    typedef QHash<QString, QStringList> Locations;  // include directories for each include code
+    static ScanResults scanFiles(const QStringList &files, const Locations &locations);
+    void applyResult(const ScanResult &result);
+    void enqueue(const QString &file);
+
+private:
+    static const int CMissTimeout = 5000;       // ms to keep an unresolved path in the cache
+    static const int CHitTimeout = 60000;       // ms to keep a resolved path in the cache
+    static const int CFilesPerScan = 16;        // count of files to read in one worker run
+
+    ProjectRunGroupNode *mRunGroup;
+    QHash<QString, QStringList> mIncludes;  // direct includes of each file
+    QSet<QString> mUnresolved;              // files with includes that couldn't be resolved
+    QHash<QString, CachedPath> mPaths;
+    QStringList mQueue;
+    QStringList mScanning;                  // files of the running worker
+    Locations mScanLocations;               // include directories of the running worker
+    QFutureWatcher<ScanResults> mScanner;
+    QTimer mTimer;
+    QElapsedTimer mClock;
+};
+
+} // namespace studio
+} // namespace gams
+
+#endif // INCLUDEGRAPH_H
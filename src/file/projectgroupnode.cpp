@@ -216,6 +216,8 @@ void ProjectGroupNode::hasFile(QString fName, bool &exists)
 ProjectRunGroupNode::ProjectRunGroupNode(QString name, QString path, FileMeta* runFileMeta)
     : ProjectGroupNode(name, path, NodeType::runGroup)
     , mGamsProcess(new GamsProcess())
+    , mSymbolIndex(new syntax::SymbolIndex(this))
+    , mIncludeGraph(new IncludeGraph(this))
 {
     connect(mGamsProcess.get(), &GamsProcess::stateChanged, this, &ProjectRunGroupNode::onGamsProcessStateChanged);
     if (runFileMeta && runFileMeta->kind() == FileKind::Gms) {
@@ -262,6 +264,13 @@ void ProjectRunGroupNode::appendChild(ProjectAbstractNode *child)
     if (!mParameterHash.contains("gms") && file && file->file() && file->file()->kind() == FileKind::Gms) {
         setRunnableGms(file->file());
     }
+    if (file && file->file() && file->file()->kind() == FileKind::Gms) {
+        mSymbolIndex->updateFile(file->location());
+        mIncludeGraph->updateFile(file->location());
+        connect(file->file(), &FileMeta::changed, this, &ProjectRunGroupNode::fileMetaChanged, Qt::UniqueConnection);
+        if (fileRepo())
+            connect(fileRepo(), &FileMetaRepo::fileEvent, this, &ProjectRunGroupNode::fileEvent, Qt::UniqueConnection);
+    }
 }
 
 void ProjectRunGroupNode::removeChild(ProjectAbstractNode *child)
@@ -270,6 +279,9 @@ void ProjectRunGroupNode::removeChild(ProjectAbstractNode *child)
     bool gmsLost = false;
     ProjectFileNode *file = child->toFile();
     if (file) {
+        mSymbolIndex->removeFile(file->location());
+        mIncludeGraph->removeFile(file->location());
+        if (file->file()) disconnect(file->file(), &FileMeta::changed, this, &ProjectRunGroupNode::fileMetaChanged);
         QList<QString> files = mParameterHash.keys(file->location());
         for (const QString &file: files) {
             mParameterHash.remove(file);
@@ -281,6 +293,71 @@ void ProjectRunGroupNode::removeChild(ProjectAbstractNode *child)
     }
 }
 
+QStringList ProjectRunGroupNode::includeLocations(const QString &code)
+{
+    QStringList locations;
+    if (code == "INC") {
+        locations << location();
+        QString inDir;
+        emit getParameterValue("InputDir", inDir);
+        if (inDir.isNull()) emit getParameterValue("IDir", inDir);
+        if (!inDir.isNull()) {
+            // check if there are joined paths
+            locations << QDir::fromNativeSeparators(inDir).split(QDir::listSeparator(), QString::SkipEmptyParts);
+        } else {
+            emit getParameterValue("InputDir*", inDir);
+            if (inDir.isNull()) emit getParameterValue("IDir*", inDir);
+            if (!inDir.isNull()) {
+                // there is at least one inputDir with number -> read all
+                for (int i = 1; i <= 40 ; ++i) {
+                    QString inDirX;
+                    emit getParameterValue(QString("InputDir%1").arg(i), inDirX);
+                    if (inDirX.isNull()) emit getParameterValue(QString("IDir%1").arg(i), inDirX);
+                    if (!inDirX.isNull()) {
+                        locations << QDir::fromNativeSeparators(inDirX);
+                    }
+                }
+            }
+        }
+    } else if (code == "SYS") {
+        QString sysDir;
+        emit getParameterValue("sysIncDir", sysDir);
+        if (sysDir.isNull()) emit getParameterValue("SDir", sysDir);
+        QDir dir(sysDir);
+        if (!sysDir.isNull()) {
+            if (dir.isAbsolute()) {
+                locations << QDir::fromNativeSeparators(sysDir);
+            } else {
+                locations << CommonPaths::systemDir() + '/' + sysDir;
+            }
+        } else
+            locations << CommonPaths::systemDir();
+
+    } else { // LIB
+        QString libDir;
+        emit getParameterValue("libIncDir", libDir);
+        if (libDir.isNull()) emit getParameterValue("LDir", libDir);
+
+        if (!libDir.isNull()) {
+            libDir = QDir::fromNativeSeparators(libDir);
+            QDir dir(libDir);
+            if (dir.isAbsolute()) {
+                locations << libDir;
+            } else {
+                locations << CommonPaths::systemDir() + '/' + libDir;
+            }
+        }
+        for (QString &path: CommonPaths::gamsStandardPaths(CommonPaths::StandardDataPath))
+            locations << QDir::fromNativeSeparators(path) + "/inclib";
+    }
+    // relative directories are taken relative to the group location
+    for (QString &loc : locations) {
+        if (!QDir(loc).isAbsolute())
+            loc = location() + '/' + loc;
+    }
+    return locations;
+}
+
 QString ProjectRunGroupNode::resolveHRef(QString href, ProjectFileNode *&node, int &line, int &col, bool create)
 {
     const QStringList tags {"LST","LS2","INC","LIB","SYS"};
@@ -305,76 +382,14 @@ QString ProjectRunGroupNode::resolveHRef(QString href, ProjectFileNode *&node, i
 
         } else {
             QString fName = parts.first().toString();
-            QStringList locations;
-            if (iCode == 2) { // INC
-                locations << location();
-                QString inDir;
-                emit getParameterValue("InputDir", inDir);
-                if (inDir.isNull()) emit getParameterValue("IDir", inDir);
-                if (!inDir.isNull()) {
-                    // check if there are joined paths
-                    locations << QDir::fromNativeSeparators(inDir).split(QDir::listSeparator(), QString::SkipEmptyParts);
-                } else {
-                    emit getParameterValue("InputDir*", inDir);
-                    if (inDir.isNull()) emit getParameterValue("IDir*", inDir);
-                    if (!inDir.isNull()) {
-                        // there is at least one inputDir with number -> read all
-                        for (int i = 1; i <= 40 ; ++i) {
-                            QString inDirX;
-                            emit getParameterValue(QString("InputDir%1").arg(i), inDirX);
-                            if (inDirX.isNull()) emit getParameterValue(QString("IDir%1").arg(i), inDirX);
-                            if (!inDirX.isNull()) {
-                                locations << QDir::fromNativeSeparators(inDirX);
-                            }
-                        }
-                    }
-                }
-
-            } else if (iCode == 4) { // SYS
-                QString sysDir;
-                emit getParameterValue("sysIncDir", sysDir);
-                if (sysDir.isNull()) emit getParameterValue("SDir", sysDir);
-                QDir dir(sysDir);
-                if (!sysDir.isNull()) {
-                    if (dir.isAbsolute()) {
-                        locations << QDir::fromNativeSeparators(sysDir);
-                    } else {
-                        locations << CommonPaths::systemDir() + '/' + sysDir;
-                    }
-                } else
-                    locations << CommonPaths::systemDir();
-
-            } else { // LIB
-                QString libDir;
-                emit getParameterValue("libIncDir", libDir);
-                if (libDir.isNull()) emit getParameterValue("LDir", libDir);
-
-                if (!libDir.isNull()) {
-                    libDir = QDir::fromNativeSeparators(libDir);
-                    QDir dir(libDir);
-                    if (dir.isAbsolute()) {
-                        locations << libDir;
-                    } else {
-                        locations << CommonPaths::systemDir() + '/' + libDir;
-                    }
-                }
-                for (QString &path: CommonPaths::gamsStandardPaths(CommonPaths::StandardDataPath))
-                    locations << QDir::fromNativeSeparators(path) + "/inclib";
-            }
+            QStringList locations = includeLocations(code);
             QString rawName = fName;
-            for (QString loc : locations) {
-                if (!QDir(loc).isAbsolute())
-                    loc = location() + '/' + loc;
-                fName = loc + '/' + rawName;
-                QFileInfo file(fName);
-                exist = file.exists() && file.isFile();
-                if (!exist) {
-                    file.setFile(file.filePath()+".gms");
-                    exist = file.exists() && file.isFile();
-                    if (exist) fName += ".gms";
-                }
-                if (exist) break;
+            QString cacheKey = IncludeGraph::pathKey(code, locations, rawName);
+            if (!mIncludeGraph->cachedPath(cacheKey, fName)) {
+                fName = IncludeGraph::resolveInclude(locations, rawName);
+                mIncludeGraph->cachePath(cacheKey, fName);
             }
+            exist = !fName.isEmpty();
             if (exist) res = fName;
             if (!create || !exist) return res;
             node = projectRepo()->findOrCreateFileNode(fName, this);
@@ -516,6 +531,52 @@ void ProjectRunGroupNode::jumpToHRef(const QString &href)
     if (node) node->file()->jumpTo(node->runGroupId(), true, line-1, column);
 }
 
+syntax::SymbolIndex *ProjectRunGroupNode::symbolIndex() const
+{
+    return mSymbolIndex;
+}
+
+void ProjectRunGroupNode::hasDeclaration(const QString &symbol, bool &found)
+{
+    found = mSymbolIndex->declaration(symbol).isValid();
+}
+
+void ProjectRunGroupNode::jumpToDeclaration(const QString &symbol)
+{
+    syntax::SymbolIndex::Location loc = mSymbolIndex->declaration(symbol);
+    if (!loc.isValid()) return;
+    ProjectFileNode *node = findFile(loc.file);
+    if (node) node->file()->jumpTo(id(), true, loc.line, loc.column, symbol.length());
+}
+
+void ProjectRunGroupNode::fileMetaChanged(FileId fileId)
+{
+    // re-index saved files
+    FileMeta *meta = fileRepo()->fileMeta(fileId);
+    if (meta && !meta->isModified() && mSymbolIndex->contains(meta->location()))
+        mSymbolIndex->updateFile(meta->location());
+}
+
+IncludeGraph *ProjectRunGroupNode::includeGraph() const
+{
+    return mIncludeGraph;
+}
+
+void ProjectRunGroupNode::fileEvent(FileEvent &e)
+{
+    FileMeta *meta = fileRepo()->fileMeta(e.fileId());
+    if (!meta) return;
+    if (e.kind() == FileEventKind::removedExtern)
+        mIncludeGraph->fileRemoved(meta->location());
+    else if (e.kind() == FileEventKind::created)
+        mIncludeGraph->fileCreated(meta->location());
+    else if (mIncludeGraph->contains(meta->location())
+             && (e.kind() == FileEventKind::changed || e.kind() == FileEventKind::changedExtern))
+        mIncludeGraph->updateFile(meta->location());
+    if (e.kind() == FileEventKind::changedExtern && mSymbolIndex->contains(meta->location()))
+        mSymbolIndex->updateFile(meta->location());
+}
+
 void ProjectRunGroupNode::createMarks(const LogParser::MarkData &marks)
 {
     if (marks.hasErr() && !marks.hRef.isEmpty()) {
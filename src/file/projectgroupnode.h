@@ -27,6 +27,8 @@
 #include "editors/logparser.h"
 #include "projectabstractnode.h"
 #include "syntax/textmark.h"
+#include "syntax/symbolindex.h"
+#include "includegraph.h"
 
 namespace gams {
 namespace studio {
@@ -36,6 +38,7 @@ class ProjectFileNode;
 class TextMarkRepo;
 class FileMeta;
 class FileMetaRepo;
+class FileEvent;
 namespace option {
 struct OptionItem;
 }
@@ -111,6 +114,9 @@ public:
     void setProcess(std::unique_ptr<AbstractProcess> process);
     AbstractProcess *process() const;
     bool jumpToFirstError(bool focus, ProjectFileNode *lstNode);
+    syntax::SymbolIndex *symbolIndex() const;
+    IncludeGraph *includeGraph() const;
+    QStringList includeLocations(const QString &code);
 
 signals:
     void gamsProcessStateChanged(ProjectGroupNode* group);
@@ -122,9 +128,13 @@ public slots:
     void jumpToHRef(const QString &href);
     void createMarks(const LogParser::MarkData &marks);
     void switchLst(const QString &lstFile);
+    void hasDeclaration(const QString &symbol, bool &found);
+    void jumpToDeclaration(const QString &symbol);
 
 protected slots:
     void onGamsProcessStateChanged(QProcess::ProcessState newState);
+    void fileMetaChanged(FileId fileId);
+    void fileEvent(FileEvent &e);
 
 protected:
     friend class ProjectRepo;
@@ -145,6 +155,8 @@ private:
     QHash<int, QString> mErrorTexts;
     QStringList mRunParametersHistory;
     QHash<QString, QString> mParameterHash;
+    syntax::SymbolIndex *mSymbolIndex;
+    IncludeGraph *mIncludeGraph;
 
 private:
     QString cleanPath(QString path, QString file);
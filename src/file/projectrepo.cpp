@@ -24,6 +24,7 @@
 #include "exception.h"
 #include "syntax.h"
 #include "logger.h"
+#include "diagnostics.h"
 #include "commonpaths.h"
 #include "filemetarepo.h"
 #include "process/abstractprocess.h"
@@ -219,6 +220,7 @@ TextMarkRepo *ProjectRepo::textMarkRepo() const
 
 void ProjectRepo::read(const QVariantList &data)
 {
+    DIAGNOSE("project repo")
     readGroup(mTreeModel->rootNode(), data);
 }
 
@@ -90,14 +90,12 @@ void ColumnFilterFrame::apply()
 
 void ColumnFilterFrame::selectAll()
 {
-    for(int row=0; row<mModel->rowCount(); row++)
-        mModel->setData(mModel->index(row,0), true, Qt::CheckStateRole);
+    mModel->setAllChecked(true);
 }
 
 void ColumnFilterFrame::deselectAll()
 {
-    for(int row=0; row<mModel->rowCount(); row++)
-        mModel->setData(mModel->index(row,0), false, Qt::CheckStateRole);
+    mModel->setAllChecked(false);
 }
 
 void ColumnFilterFrame::filterLabels()
@@ -20,9 +20,12 @@
 #include "filteruelmodel.h"
 #include "gdxsymbol.h"
 #include "gdxsymboltable.h"
+#include "uelindex.h"
 
 #include <QTime>
 
+#include <algorithm>
+
 namespace gams {
 namespace studio {
 namespace gdxviewer {
@@ -100,22 +103,19 @@ bool *FilterUelModel::checked() const
 
 void FilterUelModel::filterLabels(QString filterString)
 {
-    bool checkedOld, checkedNew;
-    QRegExp regExp(filterString);
-    regExp.setCaseSensitivity(Qt::CaseInsensitive);
-    regExp.setPatternSyntax(QRegExp::Wildcard);
-    for(size_t idx=0; idx<mUels->size(); idx++) {
-        int uel = mUels->at(idx);
-        checkedOld = mChecked[idx];
-        if(regExp.exactMatch(mSymbol->gdxSymbolTable()->uel2Label(uel)))
-            checkedNew = true;
-        else
-            checkedNew = false;
-        if(checkedNew != checkedOld) {
-            mChecked[idx] = checkedNew;
-            dataChanged(index(int(idx),0), index(int(idx),0));
-        }
-    }
+    std::vector<int> matches = mSymbol->uelIndex(mColumn)->match(filterString);
+    std::fill(mChecked, mChecked + mUels->size(), false);
+    for (int idx : matches)
+        mChecked[idx] = true;
+    if (rowCount() > 0)
+        emit dataChanged(index(0), index(rowCount()-1), {Qt::CheckStateRole});
+}
+
+void FilterUelModel::setAllChecked(bool checked)
+{
+    std::fill(mChecked, mChecked + mUels->size(), checked);
+    if (rowCount() > 0)
+        emit dataChanged(index(0), index(rowCount()-1), {Qt::CheckStateRole});
 }
 
 
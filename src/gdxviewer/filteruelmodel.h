@@ -43,6 +43,7 @@ public:
     bool setData(const QModelIndex &index, const QVariant &value, int role = Qt::EditRole) override;
     bool *checked() const;
     void filterLabels(QString filterString);
+    void setAllChecked(bool checked);
 
 private:
     GdxSymbol* mSymbol;
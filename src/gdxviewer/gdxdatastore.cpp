@@ -0,0 +1,219 @@
+/*
+ * This file is part of the GAMS Studio project.
+ *
+ * Copyright (c) 2017-2020 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2020 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "gdxdatastore.h"
+#include "logger.h"
+
+#include <QDateTime>
+#include <QDir>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <QStorageInfo>
+
+namespace gams {
+namespace studio {
+namespace gdxviewer {
+
+GdxSymbolData::GdxSymbolData(const QString &fileName, qint64 keyCount, qint64 valueCount)
+    : mFile(fileName), mValueCount(valueCount)
+{
+    // the values are placed in front of the keys to keep them 8-byte aligned
+    qint64 size = valueCount * qint64(sizeof(double)) + keyCount * qint64(sizeof(uint));
+    if (mFile.open(QFile::ReadOnly) && mFile.size() == size)
+        mMap = mFile.map(0, size);
+}
+
+bool GdxSymbolData::isValid() const
+{
+    return mMap;
+}
+
+const uint *GdxSymbolData::keys() const
+{
+    return reinterpret_cast<const uint*>(mMap + mValueCount * qint64(sizeof(double)));
+}
+
+const double *GdxSymbolData::values() const
+{
+    return reinterpret_cast<const double*>(mMap);
+}
+
+GdxDataStore *GdxDataStore::instance()
+{
+    // destroyed on exit, which removes the cache files with the temporary directory
+    static GdxDataStore store(dirTemplate());
+    return &store;
+}
+
+GdxDataStore::GdxDataStore(const QString &dirTemplate)
+    : mEnabled(!dirTemplate.isEmpty())
+    , mDir(mEnabled ? dirTemplate : QDir::tempPath() + "/gdxstore-XXXXXX")
+{}
+
+QString GdxDataStore::dirTemplate()
+{
+    QString temp = QDir::tempPath();
+    QByteArray fileSystem = QStorageInfo(temp).fileSystemType();
+    if (fileSystem != "tmpfs" && fileSystem != "ramfs")
+        return temp + "/gdxstore-XXXXXX";
+    QString cache = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+    if (cache.isEmpty() || !QDir().mkpath(cache)) {
+        DEB() << "No disk based directory for the GDX cache, symbol data isn't shared";
+        return QString();
+    }
+    return cache + "/gdxstore-XXXXXX";
+}
+
+QString GdxDataStore::fileKey(const QString &gdxFile)
+{
+    QFileInfo fi(gdxFile);
+    return QString("%1|%2|%3").arg(fi.canonicalFilePath()).arg(fi.size()).arg(fi.lastModified().toMSecsSinceEpoch());
+}
+
+QSharedPointer<const GdxSymbolData> GdxDataStore::find(const QString &fileKey, int symbolNr, SymbolInfo &info)
+{
+    QMutexLocker locker(&mMutex);
+    dropOutdated(fileKey);
+    if (!mEntries.contains(fileKey) || !mEntries[fileKey].contains(symbolNr))
+        return QSharedPointer<const GdxSymbolData>();
+    Entry &entry = mEntries[fileKey][symbolNr];
+    entry.lastUse = ++mUseCount;
+    QSharedPointer<const GdxSymbolData> data = entry.data.toStrongRef();
+    if (!data) {
+        QSharedPointer<GdxSymbolData> mapped(new GdxSymbolData(entry.fileName, entry.keyCount, entry.valueCount));
+        if (!mapped->isValid()) {
+            DEB() << "Could not map GDX cache file " << entry.fileName;
+            mCacheSize -= entry.size();
+            QFile::remove(entry.fileName);
+            mEntries[fileKey].remove(symbolNr);
+            return QSharedPointer<const GdxSymbolData>();
+        }
+        data = mapped;
+        entry.data = data;
+    }
+    info = entry.info;
+    return data;
+}
+
+QSharedPointer<const GdxSymbolData> GdxDataStore::store(const QString &fileKey, int symbolNr,
+                                                        const std::vector<uint> &keys,
+                                                        const std::vector<double> &values, const SymbolInfo &info)
+{
+    qint64 size = qint64(values.size() * sizeof(double) + keys.size() * sizeof(uint));
+    if (size < CMinDataSize)
+        return QSharedPointer<const GdxSymbolData>();
+    QMutexLocker locker(&mMutex);
+    if (!mEnabled || !mDir.isValid())
+        return QSharedPointer<const GdxSymbolData>();
+    dropOutdated(fileKey);
+    Entry entry;
+    entry.fileName = mDir.filePath(QString("%1.data").arg(++mFileCount));
+    entry.keyCount = qint64(keys.size());
+    entry.valueCount = qint64(values.size());
+    entry.info = info;
+    locker.unlock();
+
+    // writing may take a while for large symbols, other symbols can be served meanwhile
+    if (!writeData(entry.fileName, keys, values))
+        return QSharedPointer<const GdxSymbolData>();
+    QSharedPointer<GdxSymbolData> mapped(new GdxSymbolData(entry.fileName, entry.keyCount, entry.valueCount));
+    if (!mapped->isValid()) {
+        QFile::remove(entry.fileName);
+        return QSharedPointer<const GdxSymbolData>();
+    }
+    QSharedPointer<const GdxSymbolData> data = mapped;
+    entry.data = data;
+
+    locker.relock();
+    if (mCurrentKeys.value(fileKey.section('|', 0, -3)) != fileKey) {
+        // the GDX file changed while writing, the data is not shared
+        return data;
+    }
+    QHash<int, Entry> &entries = mEntries[fileKey];
+    if (entries.contains(symbolNr)) {
+        mCacheSize -= entries.value(symbolNr).size();
+        QFile::remove(entries.value(symbolNr).fileName);
+    }
+    entry.lastUse = ++mUseCount;
+    entries.insert(symbolNr, entry);
+    mCacheSize += entry.size();
+    evict();
+    return data;
+}
+
+void GdxDataStore::dropOutdated(const QString &fileKey)
+{
+    QString path = fileKey.section('|', 0, -3);
+    QString current = mCurrentKeys.value(path);
+    if (current == fileKey)
+        return;
+    if (!current.isEmpty()) {
+        // files that are still mapped are removed with the temporary directory
+        for (const Entry &entry : mEntries.value(current)) {
+            mCacheSize -= entry.size();
+            QFile::remove(entry.fileName);
+        }
+        mEntries.remove(current);
+    }
+    mCurrentKeys.insert(path, fileKey);
+}
+
+void GdxDataStore::evict()
+{
+    // removes the least recently used files that aren't mapped
+    while (mCacheSize > CMaxCacheSize) {
+        QHash<int, Entry> *oldestEntries = nullptr;
+        int oldestNr = -1;
+        qint64 oldestUse = 0;
+        for (QHash<int, Entry> &entries : mEntries) {
+            for (auto it = entries.begin(); it != entries.end(); ++it) {
+                if (it->data.isNull() && (!oldestEntries || it->lastUse < oldestUse)) {
+                    oldestEntries = &entries;
+                    oldestNr = it.key();
+                    oldestUse = it->lastUse;
+                }
+            }
+        }
+        if (!oldestEntries)
+            return;
+        const Entry &entry = oldestEntries->value(oldestNr);
+        mCacheSize -= entry.size();
+        QFile::remove(entry.fileName);
+        oldestEntries->remove(oldestNr);
+    }
+}
+
+bool GdxDataStore::writeData(const QString &fileName, const std::vector<uint> &keys, const std::vector<double> &values)
+{
+    QSaveFile file(fileName);
+    if (!file.open(QFile::WriteOnly))
+        return false;
+    qint64 valueSize = qint64(values.size() * sizeof(double));
+    qint64 keySize = qint64(keys.size() * sizeof(uint));
+    if (file.write(reinterpret_cast<const char*>(values.data()), valueSize) != valueSize)
+        return false;
+    if (keySize && file.write(reinterpret_cast<const char*>(keys.data()), keySize) != keySize)
+        return false;
+    return file.commit();
+}
+
+} // namespace gdxviewer
+} // namespace studio
+} // namespace gams
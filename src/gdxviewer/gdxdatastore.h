@@ -0,0 +1,112 @@
+/*
+ * This file is part of the GAMS Studio project.
+ *
+ * Copyright (c) 2017-2020 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2020 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef GAMS_STUDIO_GDXVIEWER_GDXDATASTORE_H
+#define GAMS_STUDIO_GDXVIEWER_GDXDATASTORE_H
+
+#include <QFile>
+#include <QHash>
+#include <QMutex>
+#include <QSharedPointer>
+#include <QTemporaryDir>
+#include <vector>
+
+namespace gams {
+namespace studio {
+namespace gdxviewer {
+
+///
+/// \brief Keys and values of a loaded symbol, memory-mapped from a cache file.
+///
+class GdxSymbolData
+{
+public:
+    GdxSymbolData(const QString &fileName, qint64 keyCount, qint64 valueCount);
+    bool isValid() const;
+    const uint *keys() const;
+    const double *values() const;
+
+private:
+    QFile mFile;
+    uchar *mMap = nullptr;
+    qint64 mValueCount;
+};
+
+///
+/// \brief Process-wide store of decoded GDX symbol data.
+/// \details Symbols are identified by the file key (path, size and modification time of the GDX file) and
+/// the symbol number. The data of a loaded symbol is written to a cache file in a temporary directory and
+/// mapped into memory, so viewers of the same file share it. The mapping is released with the last
+/// GdxSymbol using it, while the cache file is kept until the GDX file changes, the cache exceeds its size
+/// limit or the application exits. If the temporary directory is held in memory (tmpfs), the cache files are
+/// placed in the user cache directory, otherwise they would double the memory usage.
+///
+class GdxDataStore
+{
+public:
+    struct SymbolInfo {
+        std::vector<int> minUel;
+        std::vector<int> maxUel;
+        std::vector<double> minDouble;
+        std::vector<double> maxDouble;
+    };
+
+    static GdxDataStore *instance();
+    static QString fileKey(const QString &gdxFile);
+
+    QSharedPointer<const GdxSymbolData> find(const QString &fileKey, int symbolNr, SymbolInfo &info);
+    QSharedPointer<const GdxSymbolData> store(const QString &fileKey, int symbolNr, const std::vector<uint> &keys,
+                                              const std::vector<double> &values, const SymbolInfo &info);
+
+private:
+    struct Entry {
+        QString fileName;
+        qint64 keyCount = 0;
+        qint64 valueCount = 0;
+        SymbolInfo info;
+        QWeakPointer<const GdxSymbolData> data;
+        qint64 lastUse = 0;
+        qint64 size() const { return valueCount * qint64(sizeof(double)) + keyCount * qint64(sizeof(uint)); }
+    };
+
+    explicit GdxDataStore(const QString &dirTemplate);
+    void dropOutdated(const QString &fileKey);
+    void evict();
+    static QString dirTemplate();
+    static bool writeData(const QString &fileName, const std::vector<uint> &keys, const std::vector<double> &values);
+
+private:
+    static const qint64 CMinDataSize = 1024*1024;           // smaller symbols are read from the GDX file again
+    static const qint64 CMaxCacheSize = 2048LL*1024*1024;   // total size of the cache files, mapped ones are kept
+
+    QMutex mMutex;
+    bool mEnabled;
+    QTemporaryDir mDir;
+    QHash<QString, QHash<int, Entry>> mEntries;
+    QHash<QString, QString> mCurrentKeys;
+    int mFileCount = 0;
+    qint64 mCacheSize = 0;
+    qint64 mUseCount = 0;
+};
+
+} // namespace gdxviewer
+} // namespace studio
+} // namespace gams
+
+#endif // GAMS_STUDIO_GDXVIEWER_GDXDATASTORE_H
@@ -19,14 +19,19 @@
  */
 #include "gdxsymbol.h"
 #include "exception.h"
+#include "diagnostics.h"
 #include "gdxsymboltable.h"
 #include "nestedheaderview.h"
+#include "symbolstatistics.h"
+#include "uelindex.h"
 #include "valuefilter.h"
 
 #include <QMutex>
 #include <QSet>
+#include <QtConcurrent>
 
 #include <cmath>
+#include <cstring>
 
 namespace gams {
 namespace studio {
@@ -35,6 +40,7 @@ namespace gdxviewer {
 GdxSymbol::GdxSymbol(gdxHandle_t gdx, QMutex* gdxMutex, int nr, GdxSymbolTable* gdxSymbolTable, QObject *parent)
     : QAbstractTableModel(parent), mGdx(gdx), mNr(nr), mGdxMutex(gdxMutex), mGdxSymbolTable(gdxSymbolTable)
 {
+    mFormatCache.setMaxCost(CFormatCacheSize);
     loadMetaData();
     loadDomains();
 
@@ -64,8 +70,14 @@ GdxSymbol::GdxSymbol(gdxHandle_t gdx, QMutex* gdxMutex, int nr, GdxSymbolTable*
 
 GdxSymbol::~GdxSymbol()
 {
+    // the cache file is written from the load buffers
+    mStoreWatcher.waitForFinished();
+    // stops a running calculation before the values are released
+    delete mStatistics;
     for(auto v : mUelsInColumn)
         delete v;
+    for(auto i : mUelIndex)
+        delete i;
     for(auto a: mShowUelInColumn) {
         if(a)
             delete[] a;
@@ -147,8 +159,9 @@ QVariant GdxSymbol::data(const QModelIndex &index, int role) const
                 val = mValues[row*GMS_DT_MAX + (index.column()-mDim)];
             if (mType == GMS_DT_SET)
                 return mGdxSymbolTable->getElementText((int) val);
-            else
-                return formatValue(val);
+            if (val<GMS_SV_UNDEF && !isFormatCached(val))
+                formatColumnSlice(index.row(), index.column());
+            return formatValue(val);
         }
     }
     else if (role == Qt::TextAlignmentRole) {
@@ -165,6 +178,7 @@ QVariant GdxSymbol::data(const QModelIndex &index, int role) const
 
 void GdxSymbol::loadData()
 {
+    DIAGNOSE("gdx model")
     QMutexLocker locker(mGdxMutex);
     mMinUel.resize(mDim);
     for(int i=0; i<mDim; i++)
@@ -174,16 +188,21 @@ void GdxSymbol::loadData()
     for(int i=0; i<mDim; i++)
         mMaxUel[i] = INT_MIN;
     if(!mIsLoaded) {
+        if (loadStoredData())
+            return;
         beginResetModel();
         endResetModel();
 
-        if(mKeys.empty())
-            mKeys.resize(mRecordCount*mDim);
-        if(mValues.empty()) {
+        if(mKeyBuffer.empty()) {
+            mKeyBuffer.resize(mRecordCount*mDim);
+            mKeys = mKeyBuffer.data();
+        }
+        if(mValueBuffer.empty()) {
             if (mType == GMS_DT_PAR || mType == GMS_DT_SET)
-                mValues.resize(mRecordCount);
+                mValueBuffer.resize(mRecordCount);
             else  if (mType == GMS_DT_EQU || mType == GMS_DT_VAR)
-                 mValues.resize(mRecordCount*GMS_DT_MAX);
+                 mValueBuffer.resize(mRecordCount*GMS_DT_MAX);
+            mValues = mValueBuffer.data();
         }
 
         int dummy;
@@ -216,16 +235,16 @@ void GdxSymbol::loadData()
 
             for(int j=0; j<mDim; j++) {
                 k = keys[j];
-                mKeys[keyOffset+j] = k;
+                mKeyBuffer[keyOffset+j] = k;
                 mMinUel[j] = qMin(mMinUel[j], k);
                 mMaxUel[j] = qMax(mMaxUel[j], k);
             }
             if (mType == GMS_DT_PAR || mType == GMS_DT_SET)
-                mValues[i] = values[0];
+                mValueBuffer[i] = values[0];
             else if (mType == GMS_DT_EQU || mType == GMS_DT_VAR) {
                 valOffset = i*GMS_VAL_MAX;
                 for(int vIdx=0; vIdx<GMS_VAL_MAX; vIdx++)
-                    mValues[valOffset+vIdx] =  values[vIdx];
+                    mValueBuffer[valOffset+vIdx] =  values[vIdx];
             }
             for(int vIdx=0; vIdx<mNumericalColumnCount; vIdx++) {
                 if (values[vIdx] < GMS_SV_UNDEF) {
@@ -259,7 +278,79 @@ void GdxSymbol::loadData()
 
         mIsLoaded = true;
         emit loadFinished();
+        // the data is shared after the symbol is shown, writing the cache file doesn't delay it
+        QMetaObject::invokeMethod(this, "storeData", Qt::QueuedConnection);
+    }
+}
+
+bool GdxSymbol::loadStoredData()
+{
+    GdxDataStore::SymbolInfo info;
+    QSharedPointer<const GdxSymbolData> data = GdxDataStore::instance()->find(mGdxSymbolTable->dataKey(), mNr, info);
+    if (!data)
+        return false;
+    beginResetModel();
+    mData = data;
+    mKeys = mData->keys();
+    mValues = mData->values();
+    std::vector<uint>().swap(mKeyBuffer);
+    std::vector<double>().swap(mValueBuffer);
+    mMinUel = info.minUel;
+    mMaxUel = info.maxUel;
+    mMinDouble = info.minDouble;
+    mMaxDouble = info.maxDouble;
+    mLoadedRecCount = mRecordCount;
+    mFilterRecCount = mRecordCount;
+    endResetModel();
+    emit triggerListViewAutoResize();
+
+    calcDefaultColumns();
+    calcUelsInColumn();
+    mIsLoaded = true;
+    emit loadFinished();
+    return true;
+}
+
+void GdxSymbol::storeData()
+{
+    if (mData || mStoreWatcher.isRunning())
+        return;
+    GdxDataStore::SymbolInfo info;
+    info.minUel = mMinUel;
+    info.maxUel = mMaxUel;
+    info.minDouble = mMinDouble;
+    info.maxDouble = mMaxDouble;
+    QString dataKey = mGdxSymbolTable->dataKey();
+    // the load buffers aren't changed once the symbol is loaded
+    connect(&mStoreWatcher, &QFutureWatcher<QSharedPointer<const GdxSymbolData>>::finished,
+            this, &GdxSymbol::storeFinished, Qt::UniqueConnection);
+    mStoreWatcher.setFuture(QtConcurrent::run([this, dataKey, info]() {
+        return GdxDataStore::instance()->store(dataKey, mNr, mKeyBuffer, mValueBuffer, info);
+    }));
+}
+
+void GdxSymbol::storeFinished()
+{
+    mData = mStoreWatcher.result();
+    releaseLoadBuffers();
+}
+
+void GdxSymbol::releaseLoadBuffers()
+{
+    if (!mData || mValues == mData->values())
+        return;
+    if (mStatistics && mStatistics->isRunning()) {
+        // the statistics may read the buffers, the release is retried when they are done
+        connect(mStatistics, &SymbolStatistics::updated, this, &GdxSymbol::releaseLoadBuffers, Qt::UniqueConnection);
+        return;
     }
+    if (mStatistics)
+        disconnect(mStatistics, &SymbolStatistics::updated, this, &GdxSymbol::releaseLoadBuffers);
+    // the views read the buffers in the GUI thread, so they can be swapped here
+    mKeys = mData->keys();
+    mValues = mData->values();
+    std::vector<uint>().swap(mKeyBuffer);
+    std::vector<double>().swap(mValueBuffer);
 }
 
 void GdxSymbol::stopLoadingData()
@@ -366,10 +457,24 @@ double GdxSymbol::specVal2SortVal(double val)
         return val; // should be an acronym
 }
 
+static quint64 formatCacheKey(double val)
+{
+    quint64 key;
+    memcpy(&key, &val, sizeof(key));
+    return key;
+}
+
 QVariant GdxSymbol::formatValue(double val) const
 {
-    if (val<GMS_SV_UNDEF)
-        return numerics::DoubleFormatter::format(val, mNumericalFormat, mNumericalPrecision, mSqueezeTrailingZeroes);
+    if (val<GMS_SV_UNDEF) {
+        QMutexLocker locker(&mFormatCacheMutex);
+        quint64 key = formatCacheKey(val);
+        if (QString *text = mFormatCache.object(key))
+            return *text;
+        QString text = numerics::DoubleFormatter::format(val, mNumericalFormat, mNumericalPrecision, mSqueezeTrailingZeroes);
+        mFormatCache.insert(key, new QString(text));
+        return text;
+    }
     if (val == GMS_SV_UNDEF)
         return "UNDF";
     if (val == GMS_SV_NA)
@@ -388,6 +493,37 @@ QVariant GdxSymbol::formatValue(double val) const
     return QVariant();
 }
 
+bool GdxSymbol::isFormatCached(double val) const
+{
+    QMutexLocker locker(&mFormatCacheMutex);
+    return mFormatCache.contains(formatCacheKey(val));
+}
+
+// formats the values of the next rows of a column in one batch, as they are most likely requested next
+void GdxSymbol::formatColumnSlice(int row, int column) const
+{
+    int last = qMin(row + CFormatSliceSize, mFilterRecCount);
+    QVector<double> values;
+    values.reserve(last - row);
+    for (int r = row; r < last; ++r) {
+        int rec = mRecSortIdx[mRecFilterIdx[r]];
+        double val = mType <= GMS_DT_PAR ? mValues[rec] : mValues[rec*GMS_DT_MAX + (column-mDim)];
+        if (val<GMS_SV_UNDEF)
+            values << val;
+    }
+    QStringList texts = numerics::DoubleFormatter::format(values, mNumericalFormat, mNumericalPrecision,
+                                                          mSqueezeTrailingZeroes);
+    QMutexLocker locker(&mFormatCacheMutex);
+    for (int i = 0; i < values.size(); ++i)
+        mFormatCache.insert(formatCacheKey(values.at(i)), new QString(texts.at(i)));
+}
+
+void GdxSymbol::clearFormatCache()
+{
+    QMutexLocker locker(&mFormatCacheMutex);
+    mFormatCache.clear();
+}
+
 void GdxSymbol::initNumericalBounds()
 {
     if(mType == GMS_DT_PAR) {
@@ -408,6 +544,7 @@ void GdxSymbol::initNumericalBounds()
 void GdxSymbol::setNumericalFormat(const numerics::DoubleFormatter::Format &numericalFormat)
 {
     mNumericalFormat = numericalFormat;
+    clearFormatCache();
 }
 
 int GdxSymbol::filterColumnCount()
@@ -420,6 +557,7 @@ void GdxSymbol::setNumericalPrecision(int numericalPrecision, bool squeezeTraili
     beginResetModel();
     mNumericalPrecision = numericalPrecision;
     mSqueezeTrailingZeroes = squeezeTrailingZeroes;
+    clearFormatCache();
     endResetModel();
 }
 
@@ -490,6 +628,22 @@ std::vector<std::vector<int> *> GdxSymbol::uelsInColumn() const
     return mUelsInColumn;
 }
 
+UelIndex *GdxSymbol::uelIndex(int column)
+{
+    if (mUelIndex.empty())
+        mUelIndex.resize(mUelsInColumn.size(), nullptr);
+    if (!mUelIndex.at(column))
+        mUelIndex.at(column) = new UelIndex(*mUelsInColumn.at(column), mGdxSymbolTable);
+    return mUelIndex.at(column);
+}
+
+SymbolStatistics *GdxSymbol::statistics()
+{
+    if (!mStatistics)
+        mStatistics = new SymbolStatistics(this);
+    return mStatistics;
+}
+
 void GdxSymbol::resetSortFilter()
 {
     for(int i=0; i<mRecordCount; i++) {
@@ -533,6 +687,7 @@ int GdxSymbol::subType() const
  */
 void GdxSymbol::sort(int column, Qt::SortOrder order)
 {
+    DIAGNOSE("gdx model")
     // sort by key column
     if(column<mDim) {
         std::vector<int> labelCompIdx = mGdxSymbolTable->labelCompIdx();
@@ -604,6 +759,7 @@ void GdxSymbol::sort(int column, Qt::SortOrder order)
 
 void GdxSymbol::filterRows()
 {
+    DIAGNOSE("gdx model")
     for (int i=0; i<mRecordCount; i++)
         mRecFilterIdx[i] = i;
 
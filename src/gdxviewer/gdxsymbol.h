@@ -21,26 +21,31 @@
 #define GAMS_STUDIO_GDXVIEWER_GDXSYMBOLDATATABLEMODEL_H
 
 #include <QAbstractTableModel>
+#include <QCache>
+#include <QFutureWatcher>
+#include <QMutex>
 #include <QString>
 #include <QTableView>
 
 #include "gdxcc.h"
+#include "gdxdatastore.h"
 #include "numerics/doubleformatter.h"
 
-class QMutex;
-
 namespace gams {
 namespace studio {
 namespace gdxviewer {
 
 class GdxSymbolTable;
+class SymbolStatistics;
 class TableViewModel;
+class UelIndex;
 class ValueFilter;
 
 class GdxSymbol : public QAbstractTableModel
 {
     Q_OBJECT
 
+    friend class SymbolStatistics;
     friend class TableViewModel;
 
 public:
@@ -72,6 +77,8 @@ public:
     std::vector<std::vector<int> *> uelsInColumn() const;
     std::vector<bool *> showUelInColumn() const;
     void setShowUelInColumn(const std::vector<bool *> &showUelInColumn);
+    UelIndex *uelIndex(int column);
+    SymbolStatistics *statistics();
 
     bool filterActive(int column) const;
     void setFilterActive(int column, bool active=true);
@@ -98,6 +105,11 @@ signals:
     void loadFinished();
     void triggerListViewAutoResize();
 
+private slots:
+    void storeData();
+    void storeFinished();
+    void releaseLoadBuffers();
+
 private:
     void calcDefaultColumns();
     void calcDefaultColumnsTableView();
@@ -105,7 +117,11 @@ private:
     void loadMetaData();
     void loadDomains();
     double specVal2SortVal(double val);
+    bool loadStoredData();
     QVariant formatValue(double val) const;
+    bool isFormatCached(double val) const;
+    void formatColumnSlice(int row, int column) const;
+    void clearFormatCache();
 
 private:
     void initNumericalBounds();
@@ -133,8 +149,13 @@ private:
 
     bool stopLoading = false;
 
-    std::vector<uint> mKeys;
-    std::vector<double> mValues;
+    // point to the load buffers while loading and to the shared store afterwards
+    const uint* mKeys = nullptr;
+    const double* mValues = nullptr;
+    std::vector<uint> mKeyBuffer;
+    std::vector<double> mValueBuffer;
+    QSharedPointer<const GdxSymbolData> mData;
+    QFutureWatcher<QSharedPointer<const GdxSymbolData>> mStoreWatcher;
 
     QStringList mDomains;
 
@@ -145,6 +166,8 @@ private:
     std::vector<std::vector<int>*> mUelsInColumn;
     std::vector<bool*> mShowUelInColumn;
     std::vector<bool> mFilterActive;
+    std::vector<UelIndex*> mUelIndex;
+    SymbolStatistics* mStatistics = nullptr;
 
     std::vector<int> mRecSortIdx;
     std::vector<int> mRecFilterIdx;
@@ -157,6 +180,11 @@ private:
 
     std::vector<ValueFilter*> mValueFilters;
     int mNumericalColumnCount;
+
+    static const int CFormatCacheSize = 50000; // max number of formatted values kept per symbol
+    static const int CFormatSliceSize = 64; // rows formatted at once on a cache miss
+    mutable QCache<quint64, QString> mFormatCache;
+    mutable QMutex mFormatCacheMutex;
 };
 
 } // namespace gdxviewer
@@ -28,8 +28,9 @@ namespace gams {
 namespace studio {
 namespace gdxviewer {
 
-GdxSymbolTable::GdxSymbolTable(gdxHandle_t gdx, QMutex* gdxMutex, QTextCodec* codec, QObject *parent)
-    : QAbstractTableModel(parent), mGdx(gdx), mGdxMutex(gdxMutex), mCodec(codec)
+GdxSymbolTable::GdxSymbolTable(gdxHandle_t gdx, QMutex* gdxMutex, QTextCodec* codec, const QString &dataKey,
+                               QObject *parent)
+    : QAbstractTableModel(parent), mGdx(gdx), mGdxMutex(gdxMutex), mCodec(codec), mDataKey(dataKey)
 {
     gdxSystemInfo(mGdx, &mSymbolCount, &mUelCount);
     loadUel2Label();
@@ -189,6 +190,11 @@ QTextCodec *GdxSymbolTable::codec() const
     return mCodec;
 }
 
+QString GdxSymbolTable::dataKey() const
+{
+    return mDataKey;
+}
+
 std::vector<int> GdxSymbolTable::labelCompIdx()
 {
     if (!mIsSortIndexCreated) {
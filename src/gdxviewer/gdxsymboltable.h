@@ -38,7 +38,8 @@ class GdxSymbolTable : public QAbstractTableModel
     Q_OBJECT
 
 public:
-    explicit GdxSymbolTable(gdxHandle_t gdx, QMutex* gdxMutex, QTextCodec* codec, QObject *parent = nullptr);
+    explicit GdxSymbolTable(gdxHandle_t gdx, QMutex* gdxMutex, QTextCodec* codec, const QString &dataKey,
+                            QObject *parent = nullptr);
     ~GdxSymbolTable() override;
 
     QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
@@ -52,6 +53,7 @@ public:
     QString getElementText(int textNr);
 
     QTextCodec *codec() const;
+    QString dataKey() const;
 
 private:
     QStringList mHeaderText;
@@ -74,6 +76,7 @@ private:
 
     QMutex* mGdxMutex = nullptr;
     QTextCodec *mCodec;
+    QString mDataKey;
 };
 
 } // namespace gdxviewer
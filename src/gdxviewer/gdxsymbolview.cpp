@@ -26,8 +26,12 @@
 #include "tableviewmodel.h"
 #include "common.h"
 #include "valuefilter.h"
+#include "selectionexport.h"
+#include "symbolstatistics.h"
 
 #include <QClipboard>
+#include <QFileDialog>
+#include <QMessageBox>
 #include <QWidgetAction>
 #include <QLabel>
 
@@ -43,6 +47,7 @@ GdxSymbolView::GdxSymbolView(QWidget *parent) :
 {
     ui->setupUi(this);
     ui->tvTableView->hide();
+    ui->twStatistics->hide();
 
     //create context menu
     QAction* cpComma = mContextMenuLV.addAction("Copy (comma-separated)\tCtrl+C", [this]() { copySelectionToClipboard(","); });
@@ -63,6 +68,9 @@ GdxSymbolView::GdxSymbolView(QWidget *parent) :
     mContextMenuTV.addAction("Copy Without Labels (comma-separated)", [this]() { copySelectionToClipboard(",", false); });
     mContextMenuTV.addAction("Copy Without Labels (tab-separated)", [this]() { copySelectionToClipboard("\t", false); });
 
+    QAction* aExport = mContextMenuLV.addAction("Export Selection...", [this]() { exportSelection(); });
+    mContextMenuTV.addAction(aExport);
+
     mContextMenuLV.addSeparator();
     mContextMenuTV.addSeparator();
 
@@ -146,6 +154,7 @@ GdxSymbolView::GdxSymbolView(QWidget *parent) :
     connect(mSqDefaults, &QCheckBox::toggled, this, &GdxSymbolView::toggleSqueezeDefaults);
     connect(ui->pbResetSortFilter, &QPushButton::clicked, this, &GdxSymbolView::resetSortFilter);
     connect(ui->pbToggleView, &QPushButton::clicked, this, &GdxSymbolView::toggleView);
+    connect(ui->pbStatistics, &QPushButton::toggled, this, &GdxSymbolView::toggleStatistics);
 
     connect(mPrecision, static_cast<void (QSpinBox::*)(int)>(&QSpinBox::valueChanged), this, &GdxSymbolView::updateNumericalPrecision);
     connect(mValFormat, static_cast<void (QComboBox::*)(int)>(&QComboBox::currentIndexChanged), this, &GdxSymbolView::updateNumericalPrecision);
@@ -247,6 +256,7 @@ void GdxSymbolView::resetSortFilter()
                 mShowValColActions[i]->setChecked(true);
         }
         mSym->resetSortFilter();
+        updateStatistics();
         ui->tvListView->horizontalHeader()->restoreState(mInitialHeaderState);
         mSqDefaults->setChecked(false);
         showListView();
@@ -281,6 +291,7 @@ void GdxSymbolView::setSym(GdxSymbol *sym, GdxSymbolTable* symbolTable)
         connect(mSym, &GdxSymbol::triggerListViewAutoResize, this, &GdxSymbolView::autoResizeColumns);
     }
     ui->tvListView->setModel(mSym);
+    connect(mSym, &GdxSymbol::modelReset, this, &GdxSymbolView::updateStatistics);
 
     if (mSym->type() == GMS_DT_EQU || mSym->type() == GMS_DT_VAR) {
         QVector<QString> valColNames;
@@ -313,81 +324,33 @@ void GdxSymbolView::copySelectionToClipboard(QString separator, bool copyLabels)
 {
     if (!ui->tvListView->model())
         return;
-    // row -> column -> QModelIndex
-    QMap<int, QMap<int, QString>> sortedSelection;
-    QTableView *tv;
-    if (mTableView)
-        tv = ui->tvTableView;
-    else {
-        tv = ui->tvListView;
-        copyLabels = false; // copy labels only available in table view mode
-    }
-
-    QModelIndexList selection = tv->selectionModel()->selection().indexes();
-    if (selection.isEmpty())
+    QTableView *tv = mTableView ? ui->tvTableView : ui->tvListView;
+    // copy labels only available in table view mode
+    SelectionExport selection(tv, separator, copyLabels && mTableView);
+    QString text;
+    if (selection.isEmpty() || !selection.toText(text))
         return;
-
-    int minRow = std::numeric_limits<int>::max();
-    int maxRow = std::numeric_limits<int>::min();
-    int minCol = std::numeric_limits<int>::max();
-    int maxCol = std::numeric_limits<int>::min();
-
-    for (QModelIndex idx : selection) {
-        int currentRow = idx.row();
-        int currentCol = idx.column();
-        if (tv->isColumnHidden(currentCol))
-            continue;
-
-        currentCol = tv->horizontalHeader()->visualIndex(currentCol);
-        QString currenText = idx.data().toString();
-        if (currenText.contains(separator)) {
-            if (currenText.contains("\'"))
-                currenText = "\"" + currenText + "\"";
-            else
-                currenText = "\'" + currenText + "\'";
-        }
-        sortedSelection[currentRow][currentCol] = currenText;
-
-        minRow = qMin(minRow, currentRow);
-        maxRow = qMax(maxRow, currentRow);
-        minCol = qMin(minCol, currentCol);
-        maxCol = qMax(maxCol, currentCol);
-    }
-
-    QStringList sList;
-    if (copyLabels) { // copy labels as well in table view mode
-        int colHeaderDim = ((NestedHeaderView*)tv->horizontalHeader())->dim();
-        int rowHeaderDim = ((NestedHeaderView*)tv->verticalHeader())->dim();
-        for (int i=0; i<colHeaderDim; i++) {
-            for (int j=0; j<rowHeaderDim; j++)
-                sList << separator;
-            for(int c=minCol; c<maxCol+1; c++) {
-                if (tv->isColumnHidden(tv->horizontalHeader()->logicalIndex(c)))
-                    continue;
-                sList << tv->model()->headerData(c, Qt::Horizontal).toStringList()[i] << separator;
-            }
-            sList.pop_back(); // remove last separator
-            sList << "\n";
-        }
-    }
-
-    for(int r=minRow; r<maxRow+1; r++) {
-        if (copyLabels) { // copy labels as well in table view mode
-            for (QString label:tv->model()->headerData(r, Qt::Vertical).toStringList())
-                sList << label << separator;
-        }
-        for(int c=minCol; c<maxCol+1; c++) {
-            if (tv->isColumnHidden(tv->horizontalHeader()->logicalIndex(c)))
-                continue;
-            sList << sortedSelection[r][c] << separator;
-        }
-        sList.pop_back(); // remove last separator
-        sList << "\n";
-    }
-    sList.pop_back();  // remove last newline
-
     QClipboard* clip = QApplication::clipboard();
-    clip->setText(sList.join(""));
+    clip->setText(text);
+}
+
+void GdxSymbolView::exportSelection()
+{
+    if (!ui->tvListView->model())
+        return;
+    QTableView *tv = mTableView ? ui->tvTableView : ui->tvListView;
+    if (!tv->selectionModel()->hasSelection())
+        return;
+    QString csvFilter("CSV file (*.csv)");
+    QString filter;
+    QString fileName = QFileDialog::getSaveFileName(this, "Export Selection...", mSym ? mSym->name() : QString(),
+                                                    csvFilter + ";;TSV file (*.tsv);;Text file (*.txt)", &filter);
+    if (fileName.isEmpty())
+        return;
+    SelectionExport selection(tv, filter == csvFilter ? "," : "\t", mTableView);
+    QString errorMessage;
+    if (!selection.toFile(fileName, errorMessage) && !errorMessage.isEmpty())
+        QMessageBox::warning(this, "Export Selection", "Could not write " + fileName + ":\n" + errorMessage);
 }
 
 void GdxSymbolView::toggleColumnHidden()
@@ -426,6 +389,79 @@ void GdxSymbolView::updateNumericalPrecision()
     }
     if (mTvModel)
         ui->tvTableView->reset();
+    if (ui->twStatistics->isVisible())
+        showStatistics();
+}
+
+void GdxSymbolView::toggleStatistics(bool checked)
+{
+    ui->twStatistics->setVisible(checked);
+    if (checked) {
+        connect(mSym->statistics(), &SymbolStatistics::updated, this, &GdxSymbolView::showStatistics,
+                Qt::UniqueConnection);
+        updateStatistics();
+    }
+}
+
+void GdxSymbolView::updateStatistics()
+{
+    if (mSym && mSym->isLoaded() && ui->pbStatistics->isChecked())
+        mSym->statistics()->update();
+}
+
+void GdxSymbolView::showStatistics()
+{
+    const QVector<ValueStatistics> stats = mSym->statistics()->statistics();
+    const QStringList rows {"Records", "Values", "Min", "Max", "Mean", "Zeros", "EPS", "NA", "UNDF",
+                            "+INF", "-INF", "Acronyms", "Distribution"};
+    QTableWidget *tw = ui->twStatistics;
+    tw->setUpdatesEnabled(false);
+    tw->clear();
+    tw->setRowCount(rows.size());
+    tw->setColumnCount(stats.size());
+    tw->setVerticalHeaderLabels(rows);
+    // block elements from U+2581 to U+2588 draw the histogram as a small bar chart
+    QString bars;
+    for (ushort c = 0x2581; c <= 0x2588; ++c)
+        bars += QChar(c);
+    for (int col = 0; col < stats.size(); ++col) {
+        const ValueStatistics &s = stats.at(col);
+        tw->setHorizontalHeaderItem(col, new QTableWidgetItem(mSym->headerData(mSym->dim()+col, Qt::Horizontal).toString()));
+        QStringList texts;
+        texts << QString::number(mSym->statistics()->recordCount()) << QString::number(s.count)
+              << (s.count ? formatStatistic(s.min) : QString()) << (s.count ? formatStatistic(s.max) : QString())
+              << (s.count ? formatStatistic(s.mean()) : QString()) << QString::number(s.zeros)
+              << QString::number(s.eps) << QString::number(s.na) << QString::number(s.undf)
+              << QString::number(s.pInf) << QString::number(s.mInf) << QString::number(s.acronyms);
+        for (int row = 0; row < texts.size(); ++row) {
+            QTableWidgetItem *item = new QTableWidgetItem(texts.at(row));
+            item->setTextAlignment(Qt::AlignRight | Qt::AlignVCenter);
+            tw->setItem(row, col, item);
+        }
+        int maxCount = 0;
+        for (int n : s.histogram)
+            maxCount = qMax(maxCount, n);
+        QString chart;
+        QStringList tip;
+        double width = (s.max - s.min) / SymbolStatistics::CHistogramBins;
+        for (int bin = 0; bin < s.histogram.size(); ++bin) {
+            int n = s.histogram.at(bin);
+            chart += n ? bars.at(qMin(n * bars.size() / maxCount, bars.size()-1)) : QChar(' ');
+            tip << QString("[%1, %2]: %3").arg(formatStatistic(s.min + bin*width))
+                   .arg(formatStatistic(s.min + (bin+1)*width)).arg(n);
+        }
+        QTableWidgetItem *item = new QTableWidgetItem(chart);
+        item->setToolTip(tip.join("\n"));
+        tw->setItem(texts.size(), col, item);
+    }
+    tw->resizeColumnsToContents();
+    tw->setUpdatesEnabled(true);
+}
+
+QString GdxSymbolView::formatStatistic(double val) const
+{
+    numerics::DoubleFormatter::Format format = static_cast<numerics::DoubleFormatter::Format>(mValFormat->currentData().toInt());
+    return numerics::DoubleFormatter::format(val, format, mPrecision->value(), mSqZeroes->isChecked());
 }
 
 void GdxSymbolView::showContextMenu(QPoint p)
@@ -510,6 +546,8 @@ void GdxSymbolView::enableControls()
         mSqDefaults->setEnabled(false);
     ui->pbResetSortFilter->setEnabled(true);
     ui->tbPreferences->setEnabled(true);
+    if (mSym->type() == GMS_DT_PAR || mSym->type() == GMS_DT_VAR || mSym->type() == GMS_DT_EQU)
+        ui->pbStatistics->setEnabled(true);
     if (mSym->dim()>1)
         ui->pbToggleView->setEnabled(true);
 }
@@ -51,6 +51,7 @@ public:
     GdxSymbol *sym() const;
     void setSym(GdxSymbol *sym, GdxSymbolTable* symbolTable);
     void copySelectionToClipboard(QString separator, bool copyLabels = true);
+    void exportSelection();
     void toggleColumnHidden();
 
 public slots:
@@ -65,6 +66,9 @@ public slots:
 private slots:
     void showContextMenu(QPoint p);
     void updateNumericalPrecision();
+    void toggleStatistics(bool checked);
+    void updateStatistics();
+    void showStatistics();
 
 private:
     Ui::GdxSymbolView *ui;
@@ -81,6 +85,7 @@ private:
 
     void selectAll();
     void resetValFormat();
+    QString formatStatistic(double val) const;
 
     QVector<QCheckBox *> mShowValColActions;
     QCheckBox* mSqDefaults = nullptr;
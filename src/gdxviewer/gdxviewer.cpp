@@ -19,6 +19,7 @@
  */
 #include "gdxviewer.h"
 #include "ui_gdxviewer.h"
+#include "gdxdatastore.h"
 #include "gdxsymbol.h"
 #include "gdxsymboltable.h"
 #include "gdxsymbolview.h"
@@ -243,7 +244,7 @@ int GdxViewer::init(bool quiet)
     ui->splitter->widget(0)->hide();
     ui->splitter->widget(1)->hide();
 
-    mGdxSymbolTable = new GdxSymbolTable(mGdx, mGdxMutex, mCodec);
+    mGdxSymbolTable = new GdxSymbolTable(mGdx, mGdxMutex, mCodec, GdxDataStore::fileKey(mGdxFile));
     mSymbolViews.resize(mGdxSymbolTable->symbolCount() + 1); // +1 because of the hidden universe symbol
 
     mSymbolTableProxyModel = new QSortFilterProxyModel(this);
@@ -23,7 +23,7 @@
 #include <QDrag>
 #include <QMimeData>
 #include <QApplication>
-#include <QMap>
+#include <QHash>
 #include "logger.h"
 
 namespace gams {
@@ -50,39 +50,64 @@ void NestedHeaderView::setModel(QAbstractItemModel *model)
 
 void NestedHeaderView::reset()
 {
+    sectionWidth.clear();
+    mSectionLabels.clear();
+    mLevelHeight = -1;
     if (this->model()) {
         int borderWidth = 10;
         QFont fnt = font();
         fnt.setBold(true);
         QFontMetrics fm(fnt);
         int dimension = dim();
-        sectionWidth.clear();
         if (orientation() == Qt::Vertical) {
             sectionWidth.resize(dimension);
-            for (int i=0; i<dimension; i++) {
-                QVector<QList<QString>> labelsInRows = sym()->labelsInRows();
-                for (QString label : labelsInRows.at(i))
-                    sectionWidth.replace(i, qMax(sectionWidth.at(i), fm.width(label)));
+            const QVector<QList<QString>> labelsInRows = sym()->labelsInRows();
+            for (int i=0; i<dimension && i<labelsInRows.size(); i++) {
+                int width = 0;
+                for (const QString &label : labelsInRows.at(i))
+                    width = qMax(width, fm.width(label));
+                sectionWidth.replace(i, width);
             }
             for (int i=0; i<dimension; i++)
                 sectionWidth.replace(i, sectionWidth.at(i) + borderWidth);
         } else {
-            QMap<QString, int> labelWidth;
-            sectionWidth.resize(this->model()->columnCount());
-            for (int i=0; i<this->model()->columnCount(); i++) {
-                for (QString label : model()->headerData(i, Qt::Horizontal).toStringList()) {
-                    if (!labelWidth.contains(label))
-                        labelWidth.insert(label, fm.width(label));
-                    sectionWidth.replace(i, qMax(sectionWidth.at(i), labelWidth[label]));
+            // the labels are kept to paint the nested sections without querying the model
+            QHash<QString, int> labelWidth;
+            int columnCount = this->model()->columnCount();
+            sectionWidth.resize(columnCount);
+            mSectionLabels.resize(columnCount);
+            for (int i=0; i<columnCount; i++) {
+                mSectionLabels[i] = model()->headerData(i, Qt::Horizontal).toStringList();
+                int width = 0;
+                for (const QString &label : mSectionLabels.at(i)) {
+                    auto it = labelWidth.find(label);
+                    if (it == labelWidth.end())
+                        it = labelWidth.insert(label, fm.width(label));
+                    width = qMax(width, it.value());
                 }
+                sectionWidth.replace(i, width + borderWidth);
             }
-            for (int i=0; i<this->model()->columnCount(); i++)
-                sectionWidth.replace(i, sectionWidth.at(i) + borderWidth);
+            if (columnCount > 0)
+                mLevelHeight = QHeaderView::sectionSizeFromContents(0).height();
         }
     }
     QHeaderView::reset();
 }
 
+QStringList NestedHeaderView::sectionLabels(int logicalIndex) const
+{
+    if (logicalIndex < mSectionLabels.size())
+        return mSectionLabels.at(logicalIndex);
+    return model()->headerData(logicalIndex, orientation(), Qt::DisplayRole).toStringList();
+}
+
+int NestedHeaderView::levelHeight() const
+{
+    if (mLevelHeight < 0)
+        mLevelHeight = QHeaderView::sectionSizeFromContents(0).height();
+    return mLevelHeight;
+}
+
 int NestedHeaderView::dim() const
 {
     if (orientation() == Qt::Vertical && sym()->needDummyRow())
@@ -115,7 +140,7 @@ void NestedHeaderView::paintSection(QPainter *painter, const QRect &rect, int lo
     opt.rect = rect;
     opt.section = logicalIndex;
 
-    QStringList labelCurSection = model()->headerData(logicalIndex, orientation(), Qt::DisplayRole).toStringList();
+    QStringList labelCurSection = sectionLabels(logicalIndex);
     QStringList labelPrevSection;
 
     // first section needs always show all labels
@@ -125,12 +150,13 @@ void NestedHeaderView::paintSection(QPainter *painter, const QRect &rect, int lo
             while (prevIndex >0 && ((QTableView*)this->parent())->isColumnHidden(prevIndex))
                 prevIndex--;
         }
-        labelPrevSection = model()->headerData(prevIndex, orientation(), Qt::DisplayRole).toStringList();
-    }
-    else {
-        for(int i=0; i<dim(); i++)
-            labelPrevSection << "";
+        labelPrevSection = sectionLabels(prevIndex);
     }
+    int dimension = dim();
+    while (labelCurSection.size() < dimension)
+        labelCurSection << "";
+    while (labelPrevSection.size() < dimension)
+        labelPrevSection << "";
     QPointF oldBO = painter->brushOrigin();
 
     int lastRowWidth = 0;
@@ -141,7 +167,7 @@ void NestedHeaderView::paintSection(QPainter *painter, const QRect &rect, int lo
 
     if(orientation() == Qt::Vertical) {
         opt.text = "";
-        for(int i=0; i<dim(); i++) {
+        for(int i=0; i<dimension; i++) {
             QStyle::State state = QStyle::State_None;
             if (isEnabled())
                 state |= QStyle::State_Enabled;
@@ -169,13 +195,13 @@ void NestedHeaderView::paintSection(QPainter *painter, const QRect &rect, int lo
             if (dimIdxEnd>-1) {
                 if (dimIdxEnd == i)
                     painter->drawLine(opt.rect.left(), opt.rect.top(), opt.rect.left(), opt.rect.bottom());
-                else if (dimIdxEnd-1 == i && dimIdxEnd == dim())
+                else if (dimIdxEnd-1 == i && dimIdxEnd == dimension)
                     painter->drawLine(opt.rect.right(), opt.rect.top(), opt.rect.right(), opt.rect.bottom());
             }
             painter->save();
         }
     } else {
-        for(int i=0; i<dim(); i++) {
+        for(int i=0; i<dimension; i++) {
             QStyle::State state = QStyle::State_None;
             if (isEnabled())
                 state |= QStyle::State_Enabled;
@@ -187,9 +213,9 @@ void NestedHeaderView::paintSection(QPainter *painter, const QRect &rect, int lo
             else
                 opt.text = "";
             opt.rect.setTop(opt.rect.top()+ lastHeight);
-            lastHeight = QHeaderView::sectionSizeFromContents(logicalIndex).height();
+            lastHeight = levelHeight();
 
-            opt.rect.setHeight(QHeaderView::sectionSizeFromContents(logicalIndex).height());
+            opt.rect.setHeight(lastHeight);
             if (opt.rect.contains(mMousePos))
                 state |= QStyle::State_MouseOver;
             opt.state = state;
@@ -198,7 +224,7 @@ void NestedHeaderView::paintSection(QPainter *painter, const QRect &rect, int lo
                 painter->restore();
                 painter->drawLine(opt.rect.left(), opt.rect.top(), opt.rect.right(), opt.rect.top());
                 painter->save();
-            } else if (dimIdxEnd-1 == i && dimIdxEnd == dim()) {
+            } else if (dimIdxEnd-1 == i && dimIdxEnd == dimension) {
                 painter->restore();
                 if (sym()->type() == GMS_DT_VAR || sym()->type() == GMS_DT_EQU)
                     painter->drawLine(opt.rect.left(), opt.rect.top(), opt.rect.right(), opt.rect.top());
@@ -356,7 +382,7 @@ int NestedHeaderView::pointToDimension(QPoint p)
                 return i;
         }
     } else {
-        int sectionHeight = QHeaderView::sectionSizeFromContents(0).height();
+        int sectionHeight = levelHeight();
         int totHeight = 0;
         for(int i=0; i<dim(); i++) {
             totHeight += sectionHeight;
@@ -410,7 +436,7 @@ int NestedHeaderView::pointToDropDimension(QPoint p)
     } else {
         if (sym()->needDummyColumn())
             return 0;
-        int sectionHeight = QHeaderView::sectionSizeFromContents(0).height();
+        int sectionHeight = levelHeight();
         int totHeight = 0;
         for(int i=0; i<dim(); i++) {
             totHeight += sectionHeight;
@@ -451,10 +477,9 @@ QSize NestedHeaderView::sectionSizeFromContents(int logicalIndex) const
         s.setWidth(totWidth);
         return s;
     } else {
-        QSize s = QHeaderView::sectionSizeFromContents(logicalIndex);
-        s.setHeight(s.height()*dim());
-        s.setWidth(sectionWidth.at(logicalIndex));
-        return s;
+        if (logicalIndex >= sectionWidth.size())
+            return QHeaderView::sectionSizeFromContents(logicalIndex);
+        return QSize(sectionWidth.at(logicalIndex), levelHeight()*dim());
     }
 }
 
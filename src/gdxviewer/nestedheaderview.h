@@ -62,6 +62,8 @@ private:
     int toGlobalDim(int localDim, int orientation);
 
     TableViewModel* sym() const;
+    QStringList sectionLabels(int logicalIndex) const;
+    int levelHeight() const;
     QPoint mMousePos = QPoint(-1,-1);
     QPoint mDragStartPosition;
 
@@ -72,6 +74,8 @@ private:
     int dragOrientationEnd = -1;
 
     QVector<int> sectionWidth;
+    QVector<QStringList> mSectionLabels;    // horizontal labels per section, cached on reset
+    mutable int mLevelHeight = -1;          // height of one nested level
     bool ddEnabled = true;
 };
 
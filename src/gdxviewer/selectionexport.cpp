@@ -0,0 +1,211 @@
+/*
+ * This file is part of the GAMS Studio project.
+ *
+ * Copyright (c) 2017-2020 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2020 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "selectionexport.h"
+#include "nestedheaderview.h"
+#include <QTableView>
+#include <QHeaderView>
+#include <QItemSelectionModel>
+#include <QProgressDialog>
+#include <QSaveFile>
+#include <QTextStream>
+#include <algorithm>
+#include <limits>
+
+namespace gams {
+namespace studio {
+namespace gdxviewer {
+
+SelectionExport::SelectionExport(QTableView *view, const QString &separator, bool copyLabels, QObject *parent)
+    : QObject(parent), mView(view), mModel(view->model()), mSeparator(separator), mCopyLabels(copyLabels)
+{
+    if (!mModel || !view->selectionModel()) return;
+    const QItemSelection selection = view->selectionModel()->selection();
+    QHeaderView *hHeader = view->horizontalHeader();
+    int minCol = std::numeric_limits<int>::max();
+    int maxCol = std::numeric_limits<int>::min();
+    for (const QItemSelectionRange &range : selection) {
+        if (!range.isValid()) continue;
+        mRanges << Range {range.top(), range.bottom(), range.left(), range.right()};
+        for (int col = range.left(); col <= range.right(); ++col) {
+            if (view->isColumnHidden(col)) continue;
+            minCol = qMin(minCol, hHeader->visualIndex(col));
+            maxCol = qMax(maxCol, hHeader->visualIndex(col));
+        }
+    }
+    if (mRanges.isEmpty() || minCol > maxCol) {
+        mRanges.clear();
+        return;
+    }
+    std::sort(mRanges.begin(), mRanges.end(), [](const Range &r1, const Range &r2) { return r1.top < r2.top; });
+    mMinRow = mRanges.first().top;
+    mMaxRow = mRanges.first().bottom;
+    for (const Range &range : mRanges)
+        mMaxRow = qMax(mMaxRow, range.bottom);
+    for (int visual = minCol; visual <= maxCol; ++visual) {
+        int col = hHeader->logicalIndex(visual);
+        if (!view->isColumnHidden(col)) mColumns << col;
+    }
+    if (mCopyLabels) {
+        mColHeaderDim = static_cast<NestedHeaderView*>(view->horizontalHeader())->dim();
+        mRowHeaderDim = static_cast<NestedHeaderView*>(view->verticalHeader())->dim();
+    }
+}
+
+bool SelectionExport::isEmpty() const
+{
+    return mRanges.isEmpty();
+}
+
+bool SelectionExport::toText(QString &text)
+{
+    QStringList lines;
+    bool ok = collect([&lines](const QStringList &slice) {
+        lines << slice;
+        return true;
+    });
+    if (ok) text = lines.join('\n');
+    return ok;
+}
+
+bool SelectionExport::toFile(const QString &fileName, QString &errorMessage)
+{
+    if (isEmpty() || !mModel) return false;
+    QSaveFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        errorMessage = file.errorString();
+        return false;
+    }
+    QTextStream out(&file);
+    out.setCodec("UTF-8");
+    // each slice is written as soon as it is collected
+    bool ok = collect([&out](const QStringList &slice) {
+        for (const QString &line : slice)
+            out << line << '\n';
+        return out.status() == QTextStream::Ok;
+    });
+    if (ok) {
+        out.flush();
+        ok = out.status() == QTextStream::Ok;
+    }
+    if (!ok) {
+        file.cancelWriting();
+        if (mModelChanged) errorMessage = "The data changed during the export.";
+        else if (!mCanceled) errorMessage = file.errorString();
+        return false;
+    }
+    if (!file.commit()) {
+        errorMessage = file.errorString();
+        return false;
+    }
+    return true;
+}
+
+bool SelectionExport::collect(const SliceHandler &handleSlice)
+{
+    if (isEmpty() || !mModel) return false;
+    mLines.clear();
+    mModelChanged = false;
+    mCanceled = false;
+    // the progress dialog processes events, any change of the model invalidates the rows read so far
+    auto changed = [this]() { mModelChanged = true; };
+    QList<QMetaObject::Connection> connections;
+    connections << connect(mModel, &QAbstractItemModel::modelAboutToBeReset, this, changed);
+    connections << connect(mModel, &QAbstractItemModel::layoutAboutToBeChanged, this, changed);
+    connections << connect(mModel, &QAbstractItemModel::rowsAboutToBeRemoved, this, changed);
+    connections << connect(mModel, &QAbstractItemModel::columnsAboutToBeRemoved, this, changed);
+    connections << connect(mModel, &QObject::destroyed, this, changed);
+
+    QProgressDialog progress("Exporting selection...", "Cancel", 0, mMaxRow - mMinRow + 1, mView);
+    progress.setWindowModality(Qt::WindowModal);
+    progress.setMinimumDuration(500);
+    connect(&progress, &QProgressDialog::canceled, this, [this]() { mCanceled = true; });
+    bool ok = collectRows(progress, handleSlice);
+    progress.reset();
+
+    for (const QMetaObject::Connection &connection : connections)
+        disconnect(connection);
+    mLines.clear();
+    return ok;
+}
+
+bool SelectionExport::collectRows(QProgressDialog &progress, const SliceHandler &handleSlice)
+{
+    QStringList fields;
+    if (mCopyLabels) {
+        for (int i = 0; i < mColHeaderDim; ++i) {
+            fields.clear();
+            for (int j = 0; j < mRowHeaderDim; ++j)
+                fields << QString();
+            for (int col : mColumns)
+                fields << quoted(mModel->headerData(col, Qt::Horizontal).toStringList().value(i));
+            mLines << fields.join(mSeparator);
+        }
+    }
+
+    // ranges that cover the current row, new ranges are added in order of their top row
+    QVector<Range> active;
+    int next = 0;
+    for (int row = mMinRow; row <= mMaxRow; ++row) {
+        for (int i = active.size()-1; i >= 0; --i) {
+            if (active.at(i).bottom < row) active.remove(i);
+        }
+        while (next < mRanges.size() && mRanges.at(next).top <= row)
+            active << mRanges.at(next++);
+
+        fields.clear();
+        if (mCopyLabels) {
+            for (const QString &label : mModel->headerData(row, Qt::Vertical).toStringList())
+                fields << quoted(label);
+        }
+        for (int col : mColumns) {
+            bool selected = false;
+            for (const Range &range : active) {
+                if (col >= range.left && col <= range.right) {
+                    selected = true;
+                    break;
+                }
+            }
+            fields << (selected ? quoted(mModel->data(mModel->index(row, col)).toString()) : QString());
+        }
+        mLines << fields.join(mSeparator);
+        if ((row - mMinRow + 1) % CProgressStep == 0) {
+            if (!handleSlice(mLines)) return false;
+            mLines.clear();
+            progress.setValue(row - mMinRow + 1);
+            if (mCanceled || mModelChanged || !mModel) return false;
+        }
+    }
+    if (mCanceled || mModelChanged) return false;
+    return handleSlice(mLines);
+}
+
+QString SelectionExport::quoted(QString text) const
+{
+    // RFC 4180: fields containing the separator, a quote or a line break are quoted, quotes are doubled
+    if (text.contains(mSeparator) || text.contains('"') || text.contains('\n') || text.contains('\r')) {
+        text.replace('"', "\"\"");
+        text = '"' + text + '"';
+    }
+    return text;
+}
+
+} // namespace gdxviewer
+} // namespace studio
+} // namespace gams
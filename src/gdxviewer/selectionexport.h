@@ -0,0 +1,87 @@
+/*
+ * This file is part of the GAMS Studio project.
+ *
+ * Copyright (c) 2017-2020 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2020 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef GAMS_STUDIO_GDXVIEWER_SELECTIONEXPORT_H
+#define GAMS_STUDIO_GDXVIEWER_SELECTIONEXPORT_H
+
+#include <QObject>
+#include <QVector>
+#include <QStringList>
+#include <QPointer>
+#include <functional>
+
+class QTableView;
+class QAbstractItemModel;
+class QProgressDialog;
+
+namespace gams {
+namespace studio {
+namespace gdxviewer {
+
+///
+/// \brief The SelectionExport writes the selection of a GDX view as separated text.
+/// \details The selected cells are read from the model on the GUI thread in slices while a modal progress dialog
+/// allows to cancel. A reset or layout change of the model aborts the export. Each slice is passed on as soon as it
+/// is complete, so an export to a file only holds one slice of lines in memory.
+///
+class SelectionExport : public QObject
+{
+    Q_OBJECT
+public:
+    SelectionExport(QTableView *view, const QString &separator, bool copyLabels, QObject *parent = nullptr);
+    bool isEmpty() const;
+    bool toText(QString &text);
+    bool toFile(const QString &fileName, QString &errorMessage);
+
+private:
+    struct Range {
+        int top;
+        int bottom;
+        int left;
+        int right;
+    };
+
+    typedef std::function<bool(const QStringList &lines)> SliceHandler;
+    bool collect(const SliceHandler &handleSlice);
+    bool collectRows(QProgressDialog &progress, const SliceHandler &handleSlice);
+    QString quoted(QString text) const;
+
+private:
+    static const int CProgressStep = 256; // rows of a slice, the progress is updated after each slice
+
+    QTableView *mView;
+    QPointer<QAbstractItemModel> mModel;
+    QString mSeparator;
+    bool mCopyLabels;
+    QVector<Range> mRanges;         // sorted by top row
+    QVector<int> mColumns;          // logical indexes of the visible selected columns in visual order
+    int mMinRow = -1;
+    int mMaxRow = -1;
+    int mColHeaderDim = 0;
+    int mRowHeaderDim = 0;
+    QStringList mLines;             // the lines of the current slice
+    bool mModelChanged = false;
+    bool mCanceled = false;
+};
+
+} // namespace gdxviewer
+} // namespace studio
+} // namespace gams
+
+#endif // GAMS_STUDIO_GDXVIEWER_SELECTIONEXPORT_H
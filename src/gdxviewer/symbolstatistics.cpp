@@ -0,0 +1,236 @@
+/*
+ * This file is part of the GAMS Studio project.
+ *
+ * Copyright (c) 2017-2020 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2020 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "symbolstatistics.h"
+#include "gdxsymbol.h"
+#include "gdxcc.h"
+
+#include <QtConcurrent>
+
+namespace gams {
+namespace studio {
+namespace gdxviewer {
+
+static const size_t CChunkSize = 65536; // records per parallel task
+static const size_t CAbortCheck = 4096; // records between checks of the abort flag
+
+void ValueStatistics::merge(const ValueStatistics &other)
+{
+    if (other.count) {
+        min = count ? qMin(min, other.min) : other.min;
+        max = count ? qMax(max, other.max) : other.max;
+    }
+    count += other.count;
+    zeros += other.zeros;
+    eps += other.eps;
+    na += other.na;
+    undf += other.undf;
+    pInf += other.pInf;
+    mInf += other.mInf;
+    acronyms += other.acronyms;
+    sum += other.sum;
+    if (histogram.isEmpty()) {
+        histogram = other.histogram;
+    } else {
+        for (int i = 0; i < other.histogram.size(); ++i)
+            histogram[i] += other.histogram.at(i);
+    }
+}
+
+namespace {
+
+struct StatisticsChunk
+{
+    const std::vector<int> *records = nullptr;
+    const double *values = nullptr;
+    const QVector<ValueStatistics> *bounds = nullptr;
+    QAtomicInt *abort = nullptr;
+    int columns = 0;
+    size_t begin = 0;
+    size_t end = 0;
+    QVector<ValueStatistics> statistics;
+
+    void scan()
+    {
+        statistics = QVector<ValueStatistics>(columns);
+        ValueStatistics *stats = statistics.data();
+        for (size_t i = begin; i < end; ++i) {
+            if ((i - begin) % CAbortCheck == 0 && abort->load())
+                return;
+            const double *rec = values + size_t(records->at(i)) * size_t(columns);
+            for (int col = 0; col < columns; ++col) {
+                double val = rec[col];
+                ValueStatistics &s = stats[col];
+                if (val < GMS_SV_UNDEF) {
+                    if (!s.count || val < s.min) s.min = val;
+                    if (!s.count || val > s.max) s.max = val;
+                    ++s.count;
+                    s.sum += val;
+                    if (val == 0.0) ++s.zeros;
+                }
+                else if (val == GMS_SV_UNDEF) ++s.undf;
+                else if (val == GMS_SV_NA) ++s.na;
+                else if (val == GMS_SV_PINF) ++s.pInf;
+                else if (val == GMS_SV_MINF) ++s.mInf;
+                else if (val == GMS_SV_EPS) ++s.eps;
+                else if (val >= GMS_SV_ACR) ++s.acronyms;
+            }
+        }
+    }
+
+    void countBins()
+    {
+        for (ValueStatistics &s : statistics)
+            s.histogram = QVector<int>(SymbolStatistics::CHistogramBins, 0);
+        ValueStatistics *stats = statistics.data();
+        for (size_t i = begin; i < end; ++i) {
+            if ((i - begin) % CAbortCheck == 0 && abort->load())
+                return;
+            const double *rec = values + size_t(records->at(i)) * size_t(columns);
+            for (int col = 0; col < columns; ++col) {
+                double val = rec[col];
+                if (val >= GMS_SV_UNDEF)
+                    continue;
+                const ValueStatistics &b = bounds->at(col);
+                int bin = 0;
+                if (b.max > b.min)
+                    bin = qMin(int((val - b.min) / (b.max - b.min) * SymbolStatistics::CHistogramBins),
+                               SymbolStatistics::CHistogramBins - 1);
+                ++stats[col].histogram[bin];
+            }
+        }
+    }
+};
+
+} // namespace
+
+SymbolStatistics::SymbolStatistics(GdxSymbol *symbol)
+    : QObject(), mSymbol(symbol)
+{
+    mUpdateTimer.setSingleShot(true);
+    mUpdateTimer.setInterval(CUpdateDelay);
+    connect(&mUpdateTimer, &QTimer::timeout, this, &SymbolStatistics::start);
+    connect(&mWatcher, &QFutureWatcher<Result>::finished, this, &SymbolStatistics::finish);
+}
+
+SymbolStatistics::~SymbolStatistics()
+{
+    mAbort.store(1);
+    mWatcher.waitForFinished();
+}
+
+void SymbolStatistics::update()
+{
+    if (!mSymbol->isLoaded() || mSymbol->type() == GMS_DT_SET)
+        return;
+    if (!mUpdateTimer.isActive())
+        mUpdateTimer.start();
+}
+
+bool SymbolStatistics::isRunning() const
+{
+    return mWatcher.isRunning() || mUpdateTimer.isActive();
+}
+
+int SymbolStatistics::recordCount() const
+{
+    return mRecordCount;
+}
+
+QVector<ValueStatistics> SymbolStatistics::statistics() const
+{
+    return mStatistics;
+}
+
+void SymbolStatistics::start()
+{
+    if (mWatcher.isRunning()) {
+        mPending = true;
+        mAbort.store(1);
+        return;
+    }
+    mAbort.store(0);
+    // the filter and sort indices may change while calculating, the values are fixed once the symbol is loaded
+    std::vector<int> records(size_t(mSymbol->mFilterRecCount));
+    for (size_t row = 0; row < records.size(); ++row)
+        records[row] = mSymbol->mRecSortIdx[mSymbol->mRecFilterIdx[row]];
+    mWatcher.setFuture(QtConcurrent::run(&SymbolStatistics::calculate, records, mSymbol->mValues,
+                                         mSymbol->mNumericalColumnCount, &mAbort));
+}
+
+void SymbolStatistics::finish()
+{
+    if (mPending) {
+        mPending = false;
+        start();
+        return;
+    }
+    Result result = mWatcher.result();
+    if (result.aborted)
+        return;
+    mRecordCount = result.recordCount;
+    mStatistics = result.statistics;
+    emit updated();
+}
+
+SymbolStatistics::Result SymbolStatistics::calculate(std::vector<int> records, const double *values,
+                                                     int columns, QAtomicInt *abort)
+{
+    Result res;
+    QVector<StatisticsChunk> chunks;
+    for (size_t begin = 0; begin < records.size(); begin += CChunkSize) {
+        StatisticsChunk chunk;
+        chunk.records = &records;
+        chunk.values = values;
+        chunk.bounds = &res.statistics;
+        chunk.abort = abort;
+        chunk.columns = columns;
+        chunk.begin = begin;
+        chunk.end = qMin(begin + CChunkSize, records.size());
+        chunks << chunk;
+    }
+
+    QtConcurrent::blockingMap(chunks, &StatisticsChunk::scan);
+    if (abort->load())
+        return res;
+    res.statistics = QVector<ValueStatistics>(columns);
+    for (const StatisticsChunk &chunk : chunks) {
+        for (int col = 0; col < columns; ++col)
+            res.statistics[col].merge(chunk.statistics.at(col));
+    }
+
+    QtConcurrent::blockingMap(chunks, &StatisticsChunk::countBins);
+    if (abort->load())
+        return res;
+    for (ValueStatistics &s : res.statistics)
+        s.histogram = QVector<int>(CHistogramBins, 0);
+    for (const StatisticsChunk &chunk : chunks) {
+        for (int col = 0; col < columns; ++col) {
+            for (int bin = 0; bin < CHistogramBins; ++bin)
+                res.statistics[col].histogram[bin] += chunk.statistics.at(col).histogram.at(bin);
+        }
+    }
+    res.recordCount = int(records.size());
+    res.aborted = false;
+    return res;
+}
+
+} // namespace gdxviewer
+} // namespace studio
+} // namespace gams
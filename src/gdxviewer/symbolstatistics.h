@@ -0,0 +1,107 @@
+/*
+ * This file is part of the GAMS Studio project.
+ *
+ * Copyright (c) 2017-2020 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2020 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef GAMS_STUDIO_GDXVIEWER_SYMBOLSTATISTICS_H
+#define GAMS_STUDIO_GDXVIEWER_SYMBOLSTATISTICS_H
+
+#include <QAtomicInt>
+#include <QFutureWatcher>
+#include <QObject>
+#include <QTimer>
+#include <QVector>
+#include <vector>
+
+namespace gams {
+namespace studio {
+namespace gdxviewer {
+
+class GdxSymbol;
+
+struct ValueStatistics
+{
+    int count = 0; // number of regular values, special values are counted separately
+    int zeros = 0;
+    int eps = 0;
+    int na = 0;
+    int undf = 0;
+    int pInf = 0;
+    int mInf = 0;
+    int acronyms = 0;
+    double min = 0.0;
+    double max = 0.0;
+    double sum = 0.0;
+    QVector<int> histogram;
+
+    double mean() const { return count ? sum / count : 0.0; }
+    void merge(const ValueStatistics &other);
+};
+
+///
+/// \brief Computes statistics of the value columns of a loaded GdxSymbol in the background.
+/// \details Only the records that pass the active filters are taken into account. The records are split
+/// into chunks which are processed in parallel, first to get the bounds and counts and then to fill the
+/// histograms. Requesting an update while a calculation is running aborts it and starts a new one.
+///
+class SymbolStatistics : public QObject
+{
+    Q_OBJECT
+
+public:
+    static const int CHistogramBins = 16; // number of bins of the value distribution
+
+    explicit SymbolStatistics(GdxSymbol *symbol);
+    ~SymbolStatistics() override;
+
+    void update();
+    bool isRunning() const;
+    int recordCount() const;
+    QVector<ValueStatistics> statistics() const;
+
+signals:
+    void updated();
+
+private slots:
+    void start();
+    void finish();
+
+private:
+    struct Result {
+        bool aborted = true;
+        int recordCount = 0;
+        QVector<ValueStatistics> statistics;
+    };
+    static Result calculate(std::vector<int> records, const double *values, int columns,
+                            QAtomicInt *abort);
+
+private:
+    static const int CUpdateDelay = 100; // ms to collect update requests
+    GdxSymbol *mSymbol;
+    QTimer mUpdateTimer;
+    QFutureWatcher<Result> mWatcher;
+    QAtomicInt mAbort;
+    bool mPending = false;
+    int mRecordCount = 0;
+    QVector<ValueStatistics> mStatistics;
+};
+
+} // namespace gdxviewer
+} // namespace studio
+} // namespace gams
+
+#endif // GAMS_STUDIO_GDXVIEWER_SYMBOLSTATISTICS_H
@@ -0,0 +1,133 @@
+/*
+ * This file is part of the GAMS Studio project.
+ *
+ * Copyright (c) 2017-2020 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2020 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "uelindex.h"
+#include "gdxsymboltable.h"
+
+#include <QRegExp>
+#include <algorithm>
+
+namespace gams {
+namespace studio {
+namespace gdxviewer {
+
+static const QString CWildcards("*?[]");
+
+UelIndex::UelIndex(const std::vector<int> &uels, GdxSymbolTable *symbolTable)
+{
+    mLabels.reserve(static_cast<int>(uels.size()));
+    for (int uel : uels)
+        mLabels << symbolTable->uel2Label(uel).toLower();
+    mSorted.resize(uels.size());
+    for (size_t i = 0; i < mSorted.size(); ++i)
+        mSorted[i] = static_cast<int>(i);
+    std::sort(mSorted.begin(), mSorted.end(), [this](int a, int b) { return mLabels.at(a) < mLabels.at(b); });
+}
+
+std::vector<int> UelIndex::match(const QString &pattern)
+{
+    QString lowerPattern = pattern.toLower();
+    int prefixLen = 0;
+    while (prefixLen < lowerPattern.length() && !CWildcards.contains(lowerPattern.at(prefixLen)))
+        ++prefixLen;
+
+    std::vector<int> candidates;
+    if (prefixLen == lowerPattern.length()) {
+        // no wildcards: the label has to be equal to the pattern
+        candidates = prefixCandidates(lowerPattern);
+        candidates.erase(std::remove_if(candidates.begin(), candidates.end(), [this, &lowerPattern](int pos) {
+                             return mLabels.at(pos) != lowerPattern; }), candidates.end());
+        return candidates;
+    }
+    if (prefixLen > 0) {
+        candidates = prefixCandidates(lowerPattern.left(prefixLen));
+    } else {
+        QString fragment = longestLiteral(lowerPattern);
+        if (fragment.isEmpty() && !lowerPattern.contains('?') && !lowerPattern.contains('[')) {
+            // only asterisks: everything matches
+            candidates.resize(mSorted.size());
+            for (size_t i = 0; i < candidates.size(); ++i)
+                candidates[i] = static_cast<int>(i);
+            return candidates;
+        }
+        candidates = fragmentCandidates(fragment);
+    }
+
+    QRegExp regExp(lowerPattern, Qt::CaseInsensitive, QRegExp::Wildcard);
+    candidates.erase(std::remove_if(candidates.begin(), candidates.end(), [this, &regExp](int pos) {
+                         return !regExp.exactMatch(mLabels.at(pos)); }), candidates.end());
+    return candidates;
+}
+
+QString UelIndex::longestLiteral(const QString &pattern)
+{
+    // the content of a character class (e.g. "[ab]") isn't literal, it is skipped up to the closing bracket
+    QString res;
+    int start = 0;
+    int i = 0;
+    while (i <= pattern.length()) {
+        if (i == pattern.length() || CWildcards.contains(pattern.at(i))) {
+            if (i - start > res.length()) res = pattern.mid(start, i - start);
+            if (i < pattern.length() && pattern.at(i) == '[') {
+                // a closing bracket directly after the opening one belongs to the class
+                int end = pattern.indexOf(']', i + 2);
+                if (end < 0) break;
+                i = end;
+            }
+            start = i + 1;
+        }
+        ++i;
+    }
+    return res;
+}
+
+std::vector<int> UelIndex::prefixCandidates(const QString &prefix) const
+{
+    auto begin = std::lower_bound(mSorted.begin(), mSorted.end(), prefix, [this](int pos, const QString &value) {
+        return mLabels.at(pos) < value; });
+    auto end = std::partition_point(begin, mSorted.end(), [this, &prefix](int pos) {
+        return mLabels.at(pos).startsWith(prefix); });
+    std::vector<int> res(begin, end);
+    std::sort(res.begin(), res.end());
+    return res;
+}
+
+std::vector<int> UelIndex::fragmentCandidates(const QString &fragment)
+{
+    std::vector<int> res;
+    if (!mLastFragment.isEmpty() && fragment.contains(mLastFragment)) {
+        // the query has grown: only the previous candidates can still contain the fragment
+        for (int pos : mLastCandidates) {
+            if (mLabels.at(pos).contains(fragment))
+                res.push_back(pos);
+        }
+    } else {
+        for (int pos = 0; pos < mLabels.size(); ++pos) {
+            if (fragment.isEmpty() || mLabels.at(pos).contains(fragment))
+                res.push_back(pos);
+        }
+    }
+    mLastFragment = fragment;
+    mLastCandidates = res;
+    return res;
+}
+
+} // namespace gdxviewer
+} // namespace studio
+} // namespace gams
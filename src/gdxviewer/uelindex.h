@@ -0,0 +1,63 @@
+/*
+ * This file is part of the GAMS Studio project.
+ *
+ * Copyright (c) 2017-2020 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2020 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef GAMS_STUDIO_GDXVIEWER_UELINDEX_H
+#define GAMS_STUDIO_GDXVIEWER_UELINDEX_H
+
+#include <QStringList>
+#include <vector>
+
+namespace gams {
+namespace studio {
+namespace gdxviewer {
+
+class GdxSymbolTable;
+
+///
+/// \brief Search index over the labels of the UELs that occur in a single column of a symbol.
+/// \details The index is built once and keeps the lower case labels together with a sorted order of them.
+/// Patterns starting with a literal prefix are resolved by a binary search. Otherwise the labels containing
+/// the longest literal fragment of the pattern are collected, reusing the previous candidates when the
+/// fragment grows while the user types.
+///
+class UelIndex
+{
+public:
+    UelIndex(const std::vector<int> &uels, GdxSymbolTable *symbolTable);
+
+    /// Returns the positions in the column UEL list whose label matches the case insensitive wildcard pattern.
+    std::vector<int> match(const QString &pattern);
+
+private:
+    static QString longestLiteral(const QString &pattern);
+    std::vector<int> prefixCandidates(const QString &prefix) const;
+    std::vector<int> fragmentCandidates(const QString &fragment);
+
+private:
+    QStringList mLabels;
+    std::vector<int> mSorted;
+    QString mLastFragment;
+    std::vector<int> mLastCandidates;
+};
+
+} // namespace gdxviewer
+} // namespace studio
+} // namespace gams
+
+#endif // GAMS_STUDIO_GDXVIEWER_UELINDEX_H
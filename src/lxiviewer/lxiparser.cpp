@@ -18,54 +18,97 @@
  * along with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include <QDir>
-#include "exception.h"
+#include <QFile>
+#include <limits>
+#include "logger.h"
 #include "lxiparser.h"
-#include "lxitreeitem.h"
 
 namespace gams {
 namespace studio {
 namespace lxiviewer {
 
-LxiTreeModel *LxiParser::parseFile(QString lxiFile)
+LxiData LxiParser::parseFile(QString lxiFile)
 {
-    QVector<int> lineNrs;
-    QVector<LxiTreeItem*> treeItems;
-
+    LxiData data;
     QFile file(lxiFile);
-    if(!file.open(QIODevice::ReadOnly))
-        EXCEPT() << "Unable to open file: " << lxiFile;
-    QTextStream in(&file);
+    if(!file.open(QIODevice::ReadOnly)) {
+        DEB() << "Unable to open file: " << lxiFile;
+        return data;
+    }
+    // the file is tokenized in place, only the entry texts are copied
+    QByteArray content;
+    const char *buf = reinterpret_cast<const char*>(file.map(0, file.size()));
+    if (!buf) {
+        content = file.readAll();
+        buf = content.constData();
+    }
+    const int size = int(qMin(file.size(), qint64(std::numeric_limits<int>::max())));
+    data.text.reserve(size / 2);
 
-    QStringList splitList;
-    LxiTreeItem* rootItem = new LxiTreeItem();
-    LxiTreeItem* lastParent = rootItem;
-    LxiTreeItem* current = nullptr;
+    char lastIdx = 'B';
+    int start = 0;
+    while (start < size) {
+        const char *eol = static_cast<const char*>(memchr(buf + start, '\n', size_t(size - start)));
+        int end = eol ? int(eol - buf) : size;
+        int len = end - start;
+        if (len > 0 && buf[end-1] == '\r') --len;
+        parseLine(buf + start, len, data, lastIdx);
+        start = end + 1;
+    }
+    file.close();
+    data.text.squeeze();
+    return data;
+}
 
-    QString lastIdx = "B";
-    while (!in.atEnd()) {
-        splitList = in.readLine().split(' ');
-        if (splitList.size() < 2) continue;
-        QString idx = splitList.first();
-        splitList.removeFirst();
-        int lineNr = splitList.first().toInt();
-        splitList.removeFirst();
-        QString text = splitList.join(' ');
+void LxiParser::parseLine(const char *line, int len, LxiData &data, char &lastIdx)
+{
+    // line format: <idx> <lineNr> <text>
+    const char *sep1 = static_cast<const char*>(memchr(line, ' ', size_t(len)));
+    if (!sep1) return;
+    const char *end = line + len;
+    const char *sep2 = static_cast<const char*>(memchr(sep1 + 1, ' ', size_t(end - sep1 - 1)));
+    if (!sep2) sep2 = end;
 
-        if (idx == "B") {
-            lastParent = rootItem;
-        } else if (idx != lastIdx) {
-            current = new LxiTreeItem(lastIdx, -1, mCaptions[idx], rootItem);
-            rootItem->appendChild(current);
-            lastParent = current;
+    LxiEntry entry;
+    entry.idx = sep1 > line ? line[0] : 0;
+    entry.lineNr = 0;
+    for (const char *c = sep1 + 1; c < sep2; ++c) {
+        if (*c < '0' || *c > '9') {
+            entry.lineNr = 0;
+            break;
         }
-        current = new LxiTreeItem(idx, lineNr, text, lastParent);
-        lastParent->appendChild(current);
-        lineNrs.append(current->lineNr());
-        treeItems.append(current);
-        lastIdx = idx;
+        entry.lineNr = entry.lineNr * 10 + (*c - '0');
     }
-    return new LxiTreeModel(rootItem, lineNrs, treeItems);
+    entry.textStart = data.text.size();
+    if (sep2 < end) {
+        entry.textLength = int(end - sep2 - 1);
+        data.text.append(sep2 + 1, entry.textLength);
+    }
+
+    int entryNr = data.entries.size();
+    if (entry.idx == 'B') {
+        LxiNode node;
+        node.idx = entry.idx;
+        node.firstEntry = entryNr;
+        data.nodes << node;
+    } else if (entry.idx != lastIdx) {
+        LxiNode node;
+        node.idx = entry.idx;
+        node.group = true;
+        node.firstEntry = entryNr;
+        node.entryCount = 0;
+        data.nodes << node;
+    }
+    if (data.nodes.last().group) ++data.nodes.last().entryCount;
+    data.entryNode << data.nodes.size() - 1;
+    data.entries << entry;
+    data.lineNrs << entry.lineNr;
+    lastIdx = entry.idx;
+}
+
+QString LxiParser::caption(char idx)
+{
+    return mCaptions.value(QString(QChar(idx)));
 }
 
 LxiParser::LxiParser()
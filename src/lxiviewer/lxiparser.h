@@ -20,21 +20,50 @@
 #ifndef LXIPARSER_H
 #define LXIPARSER_H
 
-#include "lxitreemodel.h"
 #include <QMap>
+#include <QVector>
+#include <QByteArray>
 
 namespace gams {
 namespace studio {
 namespace lxiviewer {
 
+struct LxiEntry
+{
+    char idx = 0;           // type of the entry, see LxiParser::caption
+    int lineNr = -1;        // line in the listing file
+    int textStart = 0;      // position of the text in LxiData::text
+    int textLength = 0;
+};
+
+struct LxiNode              // top level node of the outline
+{
+    char idx = 0;
+    bool group = false;     // group nodes are virtual and hold a run of entries of the same type
+    int firstEntry = 0;
+    int entryCount = 1;
+};
+
+struct LxiData
+{
+    QByteArray text;        // the texts of all entries
+    QVector<LxiEntry> entries;
+    QVector<int> lineNrs;   // line number of each entry in the order of the file
+    QVector<LxiNode> nodes;
+    QVector<int> entryNode; // node of each entry
+    bool isEmpty() const { return entries.isEmpty(); }
+};
+
 class LxiParser
 {
 
 public:
-    static LxiTreeModel* parseFile(QString lxiFile);
+    static LxiData parseFile(QString lxiFile);
+    static QString caption(char idx);
 
 private:
     LxiParser();
+    static void parseLine(const char *line, int len, LxiData &data, char &lastIdx);
     static QMap<QString, QString> initCaptions();
     static QMap<QString, QString> mCaptions;
 };
@@ -17,74 +17,51 @@
  * You should have received a copy of the GNU General Public License
  * along with this program. If not, see <http://www.gnu.org/licenses/>.
  */
+#include <algorithm>
 #include "lxitreemodel.h"
-#include "lxitreeitem.h"
 
 namespace gams {
 namespace studio {
 namespace lxiviewer {
 
-LxiTreeModel::LxiTreeModel(LxiTreeItem *root, QVector<int> lineNrs, QVector<LxiTreeItem*> treeItems, QObject *parent)
-    : QAbstractItemModel(parent), mRootItem(root), mLineNrs(lineNrs), mTreeItems(treeItems)
+// Only the top level nodes have an internal id of 0. The children of a group node store the row of
+// the group + 1, so no items need to be created for the outline.
+
+LxiTreeModel::LxiTreeModel(const LxiData &data, QObject *parent)
+    : QAbstractItemModel(parent), mData(data)
 {
 
 }
 
 LxiTreeModel::~LxiTreeModel()
 {
-    delete mRootItem;
 }
 
 QModelIndex LxiTreeModel::index(int row, int column, const QModelIndex &parent) const
 {
     if (!hasIndex(row, column, parent))
         return QModelIndex();
-
-    LxiTreeItem *parentItem;
-
     if (!parent.isValid())
-        parentItem = mRootItem;
-    else
-        parentItem = static_cast<LxiTreeItem*>(parent.internalPointer());
-
-    LxiTreeItem *childItem = parentItem->child(row);
-    if (childItem) {
-        QModelIndex modelIndex = createIndex(row, column, childItem);
-        childItem->setModelIndex(modelIndex);
-        return modelIndex;
-    }
-    else
-        return QModelIndex();
+        return createIndex(row, column, quintptr(0));
+    return createIndex(row, column, quintptr(parent.row() + 1));
 }
 
 QModelIndex LxiTreeModel::parent(const QModelIndex &index) const
 {
-    if (!index.isValid())
+    if (!index.isValid() || !index.internalId())
         return QModelIndex();
-
-    LxiTreeItem *childItem = static_cast<LxiTreeItem*>(index.internalPointer());
-    LxiTreeItem *parentItem = childItem->parentItem();
-
-    if (parentItem == mRootItem)
-        return QModelIndex();
-
-    QModelIndex modelIndex = createIndex(parentItem->row(), 0, parentItem);
-    parentItem->setModelIndex(modelIndex);
-    return modelIndex;
+    return createIndex(int(index.internalId() - 1), 0, quintptr(0));
 }
 
 int LxiTreeModel::rowCount(const QModelIndex &parent) const
 {
-    LxiTreeItem *parentItem;
     if (parent.column() > 0)
         return 0;
-
     if (!parent.isValid())
-        parentItem = mRootItem;
-    else
-        parentItem = static_cast<LxiTreeItem*>(parent.internalPointer());
-
-    return parentItem->childCount();
+        return mData.nodes.size();
+    if (parent.internalId() || !mData.nodes.at(parent.row()).group)
+        return 0;
+    return mData.nodes.at(parent.row()).entryCount;
 }
 
 int LxiTreeModel::columnCount(const QModelIndex &parent) const
@@ -101,19 +78,43 @@ QVariant LxiTreeModel::data(const QModelIndex &index, int role) const
     if (role != Qt::DisplayRole)
         return QVariant();
 
-    LxiTreeItem *item = static_cast<LxiTreeItem*>(index.internalPointer());
+    if (isGroup(index))
+        return LxiParser::caption(mData.nodes.at(index.row()).idx);
+    const LxiEntry &entry = mData.entries.at(entryNr(index));
+    return QString::fromLocal8Bit(mData.text.constData() + entry.textStart, entry.textLength);
+}
 
-    return item->text();
+int LxiTreeModel::lineNr(const QModelIndex &index) const
+{
+    if (!index.isValid() || isGroup(index))
+        return -1;
+    return mData.entries.at(entryNr(index)).lineNr;
 }
 
-QVector<int> LxiTreeModel::lineNrs() const
+bool LxiTreeModel::isGroup(const QModelIndex &index) const
 {
-    return mLineNrs;
+    return index.isValid() && !index.internalId() && mData.nodes.at(index.row()).group;
+}
+
+QModelIndex LxiTreeModel::indexForLine(int lineNr) const
+{
+    if (mData.isEmpty())
+        return QModelIndex();
+    // last entry starting at or before the line
+    int entry = int(std::upper_bound(mData.lineNrs.constBegin(), mData.lineNrs.constEnd(), lineNr)
+                    - mData.lineNrs.constBegin()) - 1;
+    if (entry < 0) entry = 0;
+    int node = mData.entryNode.at(entry);
+    if (!mData.nodes.at(node).group)
+        return createIndex(node, 0, quintptr(0));
+    return createIndex(entry - mData.nodes.at(node).firstEntry, 0, quintptr(node + 1));
 }
 
-QVector<LxiTreeItem *> LxiTreeModel::treeItems() const
+int LxiTreeModel::entryNr(const QModelIndex &index) const
 {
-    return mTreeItems;
+    if (!index.internalId())
+        return mData.nodes.at(index.row()).firstEntry;
+    return mData.nodes.at(int(index.internalId() - 1)).firstEntry + index.row();
 }
 
 } // namespace lxiviewer
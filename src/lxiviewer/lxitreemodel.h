@@ -21,20 +21,18 @@
 #define GAMS_STUDIO_LXIVIEWER_LXITREEMODEL_H
 
 #include <QAbstractItemModel>
-#include <QVector>
+#include "lxiparser.h"
 
 namespace gams {
 namespace studio {
 namespace lxiviewer {
 
-class LxiTreeItem;
-
 class LxiTreeModel : public QAbstractItemModel
 {
     Q_OBJECT
 
 public:
-    explicit LxiTreeModel(LxiTreeItem *root, QVector<int> lineNrs, QVector<LxiTreeItem*> treeItems, QObject *parent = nullptr);
+    explicit LxiTreeModel(const LxiData &data, QObject *parent = nullptr);
     ~LxiTreeModel() override;
 
     // Basic functionality:
@@ -47,14 +45,15 @@ public:
 
     QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
 
-    QVector<int> lineNrs() const;
+    int lineNr(const QModelIndex &index) const;
+    bool isGroup(const QModelIndex &index) const;
+    QModelIndex indexForLine(int lineNr) const;
 
-    QVector<LxiTreeItem *> treeItems() const;
+private:
+    int entryNr(const QModelIndex &index) const;
 
 private:
-    LxiTreeItem* mRootItem;
-    QVector<int> mLineNrs;
-    QVector<LxiTreeItem*> mTreeItems;
+    LxiData mData;
 
 };
 
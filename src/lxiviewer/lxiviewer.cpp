@@ -18,12 +18,12 @@
  * along with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 #include <QDir>
+#include <QtConcurrent>
 #include "file.h"
 #include "process.h"
 #include "lxiviewer.h"
 #include "lxiparser.h"
 #include "lxitreemodel.h"
-#include "lxitreeitem.h"
 #include "editors/textview.h"
 #include "exception.h"
 #include "ui_lxiviewer.h"
@@ -46,6 +46,7 @@ LxiViewer::LxiViewer(TextView *textView, const QString &lstFile, QWidget *parent
     QFileInfo info(lstFile);
     mLxiFile = info.path() + "/" + info.completeBaseName() + ".lxi";
 
+    connect(&mLoadWatcher, &QFutureWatcher<LxiData>::finished, this, &LxiViewer::lxiLoaded);
     loadLxi();
     ui->splitter->setStretchFactor(0, 1);
     ui->splitter->setStretchFactor(1, 3);
@@ -57,9 +58,8 @@ LxiViewer::LxiViewer(TextView *textView, const QString &lstFile, QWidget *parent
 
 LxiViewer::~LxiViewer()
 {
-    LxiTreeModel* oldModel = static_cast<LxiTreeModel*>(ui->lxiTreeView->model());
-    if (oldModel)
-        delete oldModel;
+    mLoadWatcher.waitForFinished();
+    delete mModel;
     delete ui;
 }
 
@@ -84,55 +84,53 @@ void LxiViewer::print(QPagedPaintDevice *printer)
 void LxiViewer::loadLxi()
 {
     if (QFileInfo(mLxiFile).exists() && QFileInfo(mLxiFile).size() > 0) {
-        ui->splitter->widget(0)->show();
-        LxiTreeModel* model = LxiParser::parseFile(mLxiFile);
-        LxiTreeModel* oldModel = static_cast<LxiTreeModel*>(ui->lxiTreeView->model());
-        ui->lxiTreeView->setModel(model);
-        if (oldModel)
-            delete oldModel;
+        // the outline is shown as soon as the parser finished
+        mLoadWatcher.setFuture(QtConcurrent::run(&LxiParser::parseFile, mLxiFile));
     }
     else
         ui->splitter->widget(0)->hide();
 }
 
+void LxiViewer::lxiLoaded()
+{
+    LxiData data = mLoadWatcher.result();
+    if (data.isEmpty()) {
+        ui->splitter->widget(0)->hide();
+        return;
+    }
+    ui->splitter->widget(0)->show();
+    LxiTreeModel* oldModel = mModel;
+    mModel = new LxiTreeModel(data);
+    ui->lxiTreeView->setModel(mModel);
+    if (oldModel)
+        delete oldModel;
+}
+
 void LxiViewer::jumpToTreeItem()
 {
-    if (ui->splitter->widget(0)->isHidden())
+    if (ui->splitter->widget(0)->isHidden() || !mModel)
         return;
 
     int lineNr  = mTextView->position().y();
     if (lineNr < 0) return; // negative lineNr is estimated
 
-    LxiTreeModel* lxiTreeModel = static_cast<LxiTreeModel*>(ui->lxiTreeView->model());
-    if (!lxiTreeModel) return;
-    int itemIdx = 0;
-
-    if (lineNr >= lxiTreeModel->lineNrs().first()) {
-        itemIdx=1;
-        while (lxiTreeModel->lineNrs().size()>itemIdx && lineNr >= lxiTreeModel->lineNrs()[itemIdx])
-            itemIdx++;
-        itemIdx--;
-    }
-
-    LxiTreeItem* treeItem = lxiTreeModel->treeItems()[itemIdx];
-    if (!ui->lxiTreeView->isExpanded(treeItem->parentItem()->modelIndex()))
-        ui->lxiTreeView->expand(treeItem->parentItem()->modelIndex());
-    ui->lxiTreeView->selectionModel()->select(treeItem->modelIndex(), QItemSelectionModel::SelectCurrent);
-    ui->lxiTreeView->scrollTo(treeItem->modelIndex());
+    QModelIndex index = mModel->indexForLine(lineNr);
+    if (!index.isValid()) return;
+    if (index.parent().isValid() && !ui->lxiTreeView->isExpanded(index.parent()))
+        ui->lxiTreeView->expand(index.parent());
+    ui->lxiTreeView->selectionModel()->select(index, QItemSelectionModel::SelectCurrent);
+    ui->lxiTreeView->scrollTo(index);
 }
 
 void LxiViewer::jumpToLine(const QModelIndex &modelIndex)
 {
-    LxiTreeItem* selectedItem = static_cast<LxiTreeItem*>(modelIndex.internalPointer());
-    int lineNr = selectedItem->lineNr();
+    if (!mModel) return;
+    int lineNr = mModel->lineNr(modelIndex);
 
     //jump to first child for virtual nodes
-    if (lineNr == -1) {
-        if (!ui->lxiTreeView->isExpanded(modelIndex)) {
-            QModelIndex mi = modelIndex.model()->index(0, 0, modelIndex);
-            selectedItem = static_cast<LxiTreeItem*>(mi.internalPointer());
-            lineNr = selectedItem->lineNr();
-        }
+    if (mModel->isGroup(modelIndex)) {
+        if (!ui->lxiTreeView->isExpanded(modelIndex))
+            lineNr = mModel->lineNr(mModel->index(0, 0, modelIndex));
         else
             return;
     }
@@ -22,6 +22,8 @@
 
 #include <QWidget>
 #include <QModelIndex>
+#include <QFutureWatcher>
+#include "lxiparser.h"
 
 class QPagedPaintDevice;
 
@@ -33,6 +35,8 @@ class ProjectRunGroupNode;
 
 namespace lxiviewer {
 
+class LxiTreeModel;
+
 namespace Ui {
 class LxiViewer;
 }
@@ -54,12 +58,15 @@ public slots:
 private slots:
     void jumpToTreeItem();
     void jumpToLine(const QModelIndex &modelIndex);
+    void lxiLoaded();
 
 private:
     Ui::LxiViewer *ui;
     TextView* mTextView;
     QString mLstFile;
     QString mLxiFile;
+    LxiTreeModel *mModel = nullptr;
+    QFutureWatcher<LxiData> mLoadWatcher;
 
 };
 
@@ -98,6 +98,9 @@ MainWindow::MainWindow(QWidget *parent)
     mWinStateTimer.setSingleShot(true);
     mWinStateTimer.setInterval(10);
     connect(&mWinStateTimer, &QTimer::timeout, this, &MainWindow::pushDockSizes);
+    mTabPrefetchTimer.setSingleShot(true);
+    mTabPrefetchTimer.setInterval(200);
+    connect(&mTabPrefetchTimer, &QTimer::timeout, this, &MainWindow::prefetchTabs);
     mTimerID = startTimer(60000);
 
     setAcceptDrops(true);
@@ -163,6 +166,7 @@ MainWindow::MainWindow(QWidget *parent)
 
     connect(&mFileMetaRepo, &FileMetaRepo::fileEvent, this, &MainWindow::fileEvent);
     connect(&mFileMetaRepo, &FileMetaRepo::editableFileSizeCheck, this, &MainWindow::editableFileSizeCheck);
+    connect(&mFileMetaRepo, &FileMetaRepo::loadAmountChanged, this, &MainWindow::updateFileLoadAmount);
     connect(&mProjectRepo, &ProjectRepo::openFile, this, &MainWindow::openFile);
     connect(&mProjectRepo, &ProjectRepo::setNodeExpanded, this, &MainWindow::setProjectNodeExpanded);
     connect(&mProjectRepo, &ProjectRepo::isNodeExpanded, this, &MainWindow::isProjectNodeExpanded);
@@ -1112,6 +1116,12 @@ void MainWindow::updateLoadAmount()
     }
 }
 
+void MainWindow::updateFileLoadAmount(FileId fileId, qreal amount)
+{
+    if (mRecent.editor() && ViewHelper::fileId(mRecent.editor()) == fileId)
+        mStatusWidgets->setLoadAmount(amount);
+}
+
 void MainWindow::updateEditorItemCount()
 {
     option::SolverOptionWidget* edit = ViewHelper::toSolverOptionEdit(mRecent.editor());
@@ -1480,6 +1490,11 @@ void MainWindow::loadCommandLines(ProjectFileNode* oldfn, ProjectFileNode* fn)
 
 void MainWindow::activeTabChanged(int index)
 {
+    if (index >= 0 && ViewHelper::isPlaceholder(ui->mainTabs->widget(index))) {
+        // the real editor triggers this again
+        openTabPlaceholder(index, true);
+        return;
+    }
     ProjectFileNode* oldTab = mProjectRepo.findFileNode(mRecent.editor());
     QWidget *editWidget = (index < 0 ? nullptr : ui->mainTabs->widget(index));
     ProjectFileNode* node = mProjectRepo.findFileNode(editWidget);
@@ -2058,6 +2073,13 @@ void MainWindow::actionTerminalTriggered(const QString &workingDir)
 void MainWindow::on_mainTabs_tabCloseRequested(int index)
 {
     QWidget* widget = ui->mainTabs->widget(index);
+    if (ViewHelper::isPlaceholder(widget)) {
+        mClosedTabs << ViewHelper::restoreLocation(widget);
+        mClosedTabsIndexes << index;
+        ui->mainTabs->removeTab(index);
+        widget->deleteLater();
+        return;
+    }
     FileMeta* fc = mFileMetaRepo.fileMeta(widget);
     if (!fc) {
         // assuming we are closing a welcome page here
@@ -3026,9 +3048,12 @@ void MainWindow::openInitialFiles()
     openFiles(mInitialFiles, false);
     mInitialFiles.clear();
     watchProjectTree();
+    if (ViewHelper::isPlaceholder(ui->mainTabs->currentWidget()))
+        openTabPlaceholder(ui->mainTabs->currentIndex(), true);
     ProjectFileNode *node = mProjectRepo.findFileNode(ui->mainTabs->currentWidget());
     if (node) openFileNode(node, true);
     historyChanged();
+    mTabPrefetchTimer.start();
 }
 
 void MainWindow::on_actionRun_triggered()
@@ -3361,6 +3386,7 @@ void MainWindow::openFile(FileMeta* fileMeta, bool focus, ProjectRunGroupNode *r
     Settings *settings = Settings::settings();
     if (!fileMeta) return;
     QWidget* edit = nullptr;
+    bool restored = false;
     QTabWidget* tabWidget = fileMeta->kind() == FileKind::Log ? ui->logTabs : ui->mainTabs;
     if (!fileMeta->editors().empty()) {
         edit = fileMeta->editors().first();
@@ -3403,6 +3429,14 @@ void MainWindow::openFile(FileMeta* fileMeta, bool focus, ProjectRunGroupNode *r
             DEB() << "Error: could not create editor for '" << fileMeta->location() << "'";
             return;
         }
+        if (tabWidget == ui->mainTabs) {
+            int placeholder = tabPlaceholderIndex(fileMeta->location());
+            if (placeholder >= 0) {
+                replaceTabPlaceholder(placeholder, edit);
+                // a tab restored in the background isn't a recent user action
+                if (!focus) restored = true;
+            }
+        }
         if (ViewHelper::toCodeEdit(edit)) {
             CodeEdit* ce = ViewHelper::toCodeEdit(edit);
             connect(ce, &CodeEdit::requestAdvancedActions, this, &MainWindow::getAdvancedActions);
@@ -3441,13 +3475,13 @@ void MainWindow::openFile(FileMeta* fileMeta, bool focus, ProjectRunGroupNode *r
     if (tabWidget->currentWidget())
         if (focus) tabWidget->currentWidget()->setFocus();
 
-    if (tabWidget != ui->logTabs) {
+    if (tabWidget != ui->logTabs && !restored) {
         // if there is already a log -> show it
         ProjectFileNode* fileNode = mProjectRepo.findFileNode(edit);
         changeToLog(fileNode, false, false);
         mRecent.setEditor(tabWidget->currentWidget(), this);
     }
-    addToOpenedFiles(fileMeta->location());
+    if (!restored) addToOpenedFiles(fileMeta->location());
 }
 
 void MainWindow::openFileNode(ProjectFileNode *node, bool focus, int codecMib, bool forcedAsTextEditor, NewTabStrategy tabStrategy)
@@ -3843,7 +3877,7 @@ bool MainWindow::readTabs(const QVariantMap &tabData)
                     continue;
                 }
                 if (QFileInfo(location).exists()) {
-                    openFilePath(location, false, -1, false, tabStrategy);
+                    addTabPlaceholder(location, tabStrategy);
                     mOpenTabsList << location;
                 }
                 if (i % 10 == 0) QApplication::processEvents(QEventLoop::AllEvents, 1);
@@ -3863,10 +3897,14 @@ void MainWindow::writeTabs(QVariantMap &tabData) const
     for (int i = 0; i < ui->mainTabs->count(); ++i) {
         QWidget *wid = ui->mainTabs->widget(i);
         if (!wid || wid == mWp) continue;
-        FileMeta *fm = mFileMetaRepo.fileMeta(wid);
-        if (!fm) continue;
+        QString location = ViewHelper::restoreLocation(wid);
+        if (location.isEmpty()) {
+            FileMeta *fm = mFileMetaRepo.fileMeta(wid);
+            if (!fm) continue;
+            location = fm->location();
+        }
         QVariantMap tabObject;
-        tabObject.insert("location", fm->location());
+        tabObject.insert("location", location);
         tabArray << tabObject;
     }
     tabData.insert("mainTabs", tabArray);
@@ -3878,6 +3916,90 @@ void MainWindow::writeTabs(QVariantMap &tabData) const
         tabData.insert("mainTabRecent", "WELCOME_PAGE");
 }
 
+void MainWindow::addTabPlaceholder(const QString &location, NewTabStrategy tabStrategy)
+{
+    QWidget *placeholder = ViewHelper::initEditorType(new QWidget(ui->mainTabs), location);
+    int atIndex = ui->mainTabs->count();
+    switch (tabStrategy) {
+    case tabAtStart: atIndex = 0; break;
+    case tabBeforeCurrent: atIndex = ui->mainTabs->currentIndex() < 0 ? 0 : ui->mainTabs->currentIndex(); break;
+    case tabAfterCurrent: atIndex = ui->mainTabs->currentIndex()+1; break;
+    case tabAtEnd: atIndex = ui->mainTabs->count(); break;
+    }
+    FileMeta *fm = mFileMetaRepo.fileMeta(location);
+    int i = ui->mainTabs->insertTab(atIndex, placeholder, fm ? fm->name() : QFileInfo(location).fileName());
+    ui->mainTabs->setTabToolTip(i, QDir::toNativeSeparators(location));
+}
+
+int MainWindow::tabPlaceholderIndex(const QString &location) const
+{
+    for (int i = 0; i < ui->mainTabs->count(); ++i) {
+        QWidget *wid = ui->mainTabs->widget(i);
+        if (ViewHelper::isPlaceholder(wid) && ViewHelper::restoreLocation(wid) == location)
+            return i;
+    }
+    return -1;
+}
+
+void MainWindow::openTabPlaceholder(int index, bool focus)
+{
+    QWidget *placeholder = ui->mainTabs->widget(index);
+    QString location = ViewHelper::restoreLocation(placeholder);
+    if (QFileInfo(location).exists()) {
+        try {
+            // openFile() replaces the placeholder by the real editor
+            openFilePath(location, focus);
+        } catch (Exception &e) {
+            appendSystemLogError(e.what());
+        }
+    }
+    index = ui->mainTabs->indexOf(placeholder);
+    if (index >= 0) {
+        // the file couldn't be opened
+        ui->mainTabs->removeTab(index);
+        placeholder->deleteLater();
+    }
+}
+
+void MainWindow::replaceTabPlaceholder(int index, QWidget *edit)
+{
+    QWidget *placeholder = ui->mainTabs->widget(index);
+    ui->mainTabs->tabBar()->moveTab(ui->mainTabs->indexOf(edit), index);
+    if (ui->mainTabs->currentWidget() == placeholder)
+        ui->mainTabs->setCurrentWidget(edit);
+    ui->mainTabs->removeTab(ui->mainTabs->indexOf(placeholder));
+    placeholder->deleteLater();
+}
+
+static const qint64 CPrefetchMaxSize = 1024*1024; // larger restored tabs are only opened on activation
+
+static bool isPrefetchable(const QString &location)
+{
+    // only small text files are cheap enough to be opened without user request
+    QFileInfo fi(location);
+    if (!fi.exists() || fi.size() > CPrefetchMaxSize) return false;
+    FileKind kind = FileType::from(fi.suffix()).kind();
+    return kind == FileKind::Gms || kind == FileKind::Txt || kind == FileKind::TxtRO;
+}
+
+void MainWindow::prefetchTabs()
+{
+    // create the editors of restored tabs one by one, most recently used first
+    int index = -1;
+    for (const QString &location : mHistory.files()) {
+        index = tabPlaceholderIndex(location);
+        if (index >= 0 && isPrefetchable(location)) break;
+        index = -1;
+    }
+    for (int i = 0; index < 0 && i < ui->mainTabs->count(); ++i) {
+        QWidget *widget = ui->mainTabs->widget(i);
+        if (ViewHelper::isPlaceholder(widget) && isPrefetchable(ViewHelper::restoreLocation(widget))) index = i;
+    }
+    if (index < 0) return;
+    openTabPlaceholder(index, false);
+    mTabPrefetchTimer.start();
+}
+
 void MainWindow::goToLine(int result)
 {
     CodeEdit *codeEdit = ViewHelper::toCodeEdit(mRecent.editor());
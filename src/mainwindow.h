@@ -169,6 +169,7 @@ public slots:
     void updateEditorBlockCount();
     void updateEditorItemCount();
     void updateLoadAmount();
+    void updateFileLoadAmount(FileId fileId, qreal amount);
     void setMainGms(ProjectFileNode *node);
     void currentDocumentChanged(int from, int charsRemoved, int charsAdded);
     void getAdvancedActions(QList<QAction *> *actions);
@@ -393,6 +394,10 @@ private:
 
     void triggerGamsLibFileCreation(modeldialog::LibraryItem *item);
     void showWelcomePage();
+    void addTabPlaceholder(const QString &location, NewTabStrategy tabStrategy);
+    int tabPlaceholderIndex(const QString &location) const;
+    void openTabPlaceholder(int index, bool focus);
+    void replaceTabPlaceholder(int index, QWidget *edit);
     bool requestCloseChanged(QVector<FileMeta*> changedFiles);
     bool isActiveTabRunnable();
     bool isRecentGroupRunning();
@@ -435,6 +440,7 @@ private:
     SystemLogEdit *mSyslog = nullptr;
     StatusWidgets* mStatusWidgets;
     QTimer mWinStateTimer;
+    QTimer mTabPrefetchTimer;
 
     GamsLibProcess *mLibProcess = nullptr;
     process::GamsInstProcess *mInstProcess = nullptr;
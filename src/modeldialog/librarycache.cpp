@@ -0,0 +1,169 @@
+/*
+ * This file is part of the GAMS Studio project.
+ *
+ * Copyright (c) 2017-2020 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2020 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "librarycache.h"
+#include "glbparser.h"
+#include "logger.h"
+
+#include <QDataStream>
+#include <QDir>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QStandardPaths>
+
+namespace gams {
+namespace studio {
+namespace modeldialog {
+
+QMap<QString, CachedLibrary> LibraryCache::mLibraries;
+bool LibraryCache::mCacheFileRead = false;
+bool LibraryCache::mModified = false;
+
+bool LibraryCache::load(const QString &glbFile, CachedLibrary &library, QString &errorMessage)
+{
+    if (!mCacheFileRead)
+        readCacheFile();
+
+    QFileInfo info(glbFile);
+    QString key = info.absoluteFilePath();
+    qint64 modified = info.lastModified().toMSecsSinceEpoch();
+    auto it = mLibraries.find(key);
+    if (it != mLibraries.end() && it->modified == modified && it->size == info.size()) {
+        if (!it->searchIndex)
+            buildSearchIndex(it.value());
+        library = it.value();
+        return true;
+    }
+
+    GlbParser glbParser;
+    if (!glbParser.parseFile(glbFile)) {
+        mLibraries.remove(key);
+        errorMessage = glbParser.errorMessage();
+        return false;
+    }
+    CachedLibrary &entry = mLibraries[key];
+    entry.modified = modified;
+    entry.size = info.size();
+    entry.items = glbParser.libraryItems();
+    buildSearchIndex(entry);
+    mModified = true;
+    library = entry;
+    return true;
+}
+
+void LibraryCache::save()
+{
+    if (!mModified)
+        return;
+    QString fileName = cacheFile();
+    QDir().mkpath(QFileInfo(fileName).path());
+    QSaveFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly)) {
+        DEB() << "Could not write model library cache " << fileName;
+        return;
+    }
+    QDataStream out(&file);
+    out.setVersion(QDataStream::Qt_5_9);
+    out << CCacheMagic << CCacheVersion << qint32(mLibraries.size());
+    for (auto it = mLibraries.constBegin(); it != mLibraries.constEnd(); ++it) {
+        std::shared_ptr<Library> lib = it->items.first().library();
+        out << it.key() << it->modified << it->size;
+        out << lib->name() << lib->longName() << qint32(lib->version()) << qint32(lib->nrColumns())
+            << qint32(lib->initSortCol()) << lib->columns() << lib->toolTips() << lib->colOrder();
+        out << qint32(it->items.size());
+        for (const LibraryItem &item : it->items)
+            out << item.values() << item.description() << item.longDescription() << item.files()
+                << qint32(item.suffixNumber());
+    }
+    if (out.status() == QDataStream::Ok && file.commit())
+        mModified = false;
+}
+
+QString LibraryCache::cacheFile()
+{
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/modellibraries.cache";
+}
+
+void LibraryCache::readCacheFile()
+{
+    mCacheFileRead = true;
+    QFile file(cacheFile());
+    if (!file.open(QIODevice::ReadOnly) || !file.size())
+        return;
+    uchar *data = file.map(0, file.size());
+    if (!data)
+        return;
+    QByteArray bytes = QByteArray::fromRawData(reinterpret_cast<const char*>(data), int(file.size()));
+    QDataStream in(bytes);
+    in.setVersion(QDataStream::Qt_5_9);
+
+    quint32 magic;
+    quint32 version;
+    qint32 libCount;
+    in >> magic >> version >> libCount;
+    if (magic != CCacheMagic || version != CCacheVersion) {
+        file.unmap(data);
+        return;
+    }
+    QMap<QString, CachedLibrary> libraries;
+    for (int i = 0; i < libCount && in.status() == QDataStream::Ok; ++i) {
+        QString glbFile;
+        CachedLibrary entry;
+        QString name;
+        QString longName;
+        qint32 libVersion;
+        qint32 nrColumns;
+        qint32 initSortCol;
+        QStringList columns;
+        QStringList toolTips;
+        QList<int> colOrder;
+        qint32 itemCount;
+        in >> glbFile >> entry.modified >> entry.size;
+        in >> name >> longName >> libVersion >> nrColumns >> initSortCol >> columns >> toolTips >> colOrder;
+        in >> itemCount;
+        std::shared_ptr<Library> library = std::make_shared<Library>(name, libVersion, nrColumns, columns, initSortCol,
+                                                                     toolTips, colOrder, glbFile);
+        library->setLongName(longName);
+        for (int j = 0; j < itemCount && in.status() == QDataStream::Ok; ++j) {
+            QStringList values;
+            QString description;
+            QString longDescription;
+            QStringList files;
+            qint32 suffixNumber;
+            in >> values >> description >> longDescription >> files >> suffixNumber;
+            entry.items << LibraryItem(library, values, description, longDescription, files, suffixNumber);
+        }
+        if (!entry.items.isEmpty())
+            libraries.insert(glbFile, entry);
+    }
+    file.unmap(data);
+    if (in.status() == QDataStream::Ok)
+        mLibraries = libraries;
+    else
+        DEB() << "Ignoring corrupt model library cache " << file.fileName();
+}
+
+void LibraryCache::buildSearchIndex(CachedLibrary &library)
+{
+    library.searchIndex = std::make_shared<LibrarySearchIndex>(library.items);
+}
+
+} // namespace modeldialog
+} // namespace studio
+} // namespace gams
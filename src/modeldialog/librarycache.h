@@ -0,0 +1,67 @@
+/*
+ * This file is part of the GAMS Studio project.
+ *
+ * Copyright (c) 2017-2020 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2020 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBRARYCACHE_H
+#define LIBRARYCACHE_H
+
+#include "libraryfiltermodel.h"
+
+#include <QMap>
+
+namespace gams {
+namespace studio {
+namespace modeldialog {
+
+struct CachedLibrary
+{
+    qint64 modified = 0;
+    qint64 size = -1;
+    QList<LibraryItem> items;
+    std::shared_ptr<const LibrarySearchIndex> searchIndex;
+};
+
+///
+/// class LibraryCache
+/// Keeps the parsed GLB files of the session and mirrors them into a cache file. A GLB file is only parsed again
+/// if its modification time or size changed. The cache file is read memory-mapped once per session.
+///
+class LibraryCache
+{
+public:
+    static bool load(const QString &glbFile, CachedLibrary &library, QString &errorMessage);
+    static void save();
+
+private:
+    static const quint32 CCacheMagic = 0x474C4249; // "GLBI"
+    static const quint32 CCacheVersion = 1;
+
+    static QString cacheFile();
+    static void readCacheFile();
+    static void buildSearchIndex(CachedLibrary &library);
+
+    static QMap<QString, CachedLibrary> mLibraries;
+    static bool mCacheFileRead;
+    static bool mModified;
+};
+
+} // namespace modeldialog
+} // namespace studio
+} // namespace gams
+
+#endif // LIBRARYCACHE_H
@@ -0,0 +1,153 @@
+/*
+ * This file is part of the GAMS Studio project.
+ *
+ * Copyright (c) 2017-2020 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2020 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "libraryfiltermodel.h"
+
+#include <QSet>
+
+namespace gams {
+namespace studio {
+namespace modeldialog {
+
+namespace {
+
+inline quint64 trigramAt(const QString &text, int i)
+{
+    return (quint64(text.at(i).unicode()) << 32) | (quint64(text.at(i+1).unicode()) << 16) | text.at(i+2).unicode();
+}
+
+QVector<quint64> trigrams(const QString &text)
+{
+    QVector<quint64> res;
+    for (int i = 0; i + 2 < text.length(); ++i) {
+        quint64 gram = trigramAt(text, i);
+        if (!res.contains(gram))
+            res << gram;
+    }
+    return res;
+}
+
+}
+
+LibrarySearchIndex::LibrarySearchIndex(const QList<LibraryItem> &items)
+{
+    mTexts.reserve(items.size());
+    mNames.reserve(items.size());
+    for (int row = 0; row < items.size(); ++row) {
+        const LibraryItem &item = items.at(row);
+        mTexts << item.values().join(' ').toLower();
+        mNames << item.name().toLower();
+        QSet<quint64> grams;
+        const QString &text = mTexts.last();
+        for (int i = 0; i + 2 < text.length(); ++i)
+            grams << trigramAt(text, i);
+        for (quint64 gram : grams)
+            mTrigrams[gram] << row;
+    }
+}
+
+int LibrarySearchIndex::rowCount() const
+{
+    return mTexts.size();
+}
+
+void LibrarySearchIndex::rank(const QString &filter, QVector<int> &ranks) const
+{
+    ranks.fill(0, mTexts.size());
+    const QStringList tokens = filter.toLower().split(' ', QString::SkipEmptyParts);
+    QVector<int> hits(mTexts.size());
+    for (int t = 0; t < tokens.size(); ++t) {
+        const QString &token = tokens.at(t);
+        QVector<quint64> grams = trigrams(token);
+        hits.fill(0);
+        for (quint64 gram : grams) {
+            auto it = mTrigrams.constFind(gram);
+            if (it == mTrigrams.constEnd())
+                continue;
+            for (int row : it.value())
+                ++hits[row];
+        }
+        int required = qMax(1, (grams.size() * 2 + 2) / 3);
+
+        for (int row = 0; row < mTexts.size(); ++row) {
+            if (t > 0 && !ranks.at(row))
+                continue; // a previous token didn't match
+            int score = 0;
+            if (hits.at(row) == grams.size() && mTexts.at(row).contains(token)) {
+                score = CContainedScore;
+                if (mNames.at(row).startsWith(token))
+                    score += CNameScore + CNamePrefixScore;
+                else if (mNames.at(row).contains(token))
+                    score += CNameScore;
+            } else if (!grams.isEmpty() && hits.at(row) >= required) {
+                score = CFuzzyScore * hits.at(row) / grams.size();
+            }
+            ranks[row] = score ? ranks.at(row) + score : 0;
+        }
+    }
+}
+
+LibraryFilterModel::LibraryFilterModel(std::shared_ptr<const LibrarySearchIndex> index, QObject *parent)
+    : QSortFilterProxyModel(parent), mIndex(index)
+{}
+
+void LibraryFilterModel::setFilterText(const QString &text, bool regEx)
+{
+    // wildcards keep the former wildcard filter, any other text is ranked by the search index
+    bool ranked = !regEx && !text.trimmed().isEmpty() && !text.contains('*') && !text.contains('?');
+    if (ranked) {
+        mIndex->rank(text, mRanks);
+        mRanked = true;
+        if (!filterRegExp().isEmpty())
+            setFilterRegExp(QString());
+        invalidate();
+    } else {
+        bool wasRanked = mRanked;
+        mRanked = false;
+        if (regEx)
+            setFilterRegExp(text);
+        else
+            setFilterWildcard(text);
+        if (wasRanked)
+            invalidate();
+    }
+}
+
+bool LibraryFilterModel::filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const
+{
+    if (mRanked)
+        return sourceRow < mRanks.size() && mRanks.at(sourceRow) > 0;
+    return QSortFilterProxyModel::filterAcceptsRow(sourceRow, sourceParent);
+}
+
+bool LibraryFilterModel::lessThan(const QModelIndex &left, const QModelIndex &right) const
+{
+    if (mRanked) {
+        int leftRank = mRanks.value(left.row());
+        int rightRank = mRanks.value(right.row());
+        // the best match comes first independent of the sort order
+        if (leftRank != rightRank)
+            return (sortOrder() == Qt::AscendingOrder) ? leftRank > rightRank : leftRank < rightRank;
+    }
+    return QSortFilterProxyModel::lessThan(left, right);
+}
+
+} // namespace modeldialog
+} // namespace studio
+} // namespace gams
@@ -0,0 +1,80 @@
+/*
+ * This file is part of the GAMS Studio project.
+ *
+ * Copyright (c) 2017-2020 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2020 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBRARYFILTERMODEL_H
+#define LIBRARYFILTERMODEL_H
+
+#include "libraryitem.h"
+
+#include <QHash>
+#include <QSortFilterProxyModel>
+#include <QVector>
+
+namespace gams {
+namespace studio {
+namespace modeldialog {
+
+///
+/// class LibrarySearchIndex
+/// Trigram index over all column values of a library. Ranks the rows against a filter of whitespace separated
+/// tokens: each token has to be contained in a row or, for tokens of three and more characters, share at least two
+/// thirds of its trigrams with the row. Exact and name matches rank higher than fuzzy ones.
+///
+class LibrarySearchIndex
+{
+public:
+    explicit LibrarySearchIndex(const QList<LibraryItem> &items);
+
+    int rowCount() const;
+    void rank(const QString &filter, QVector<int> &ranks) const;
+
+private:
+    static const int CFuzzyScore = 50;      // maximal score of a token that only matches by trigrams
+    static const int CContainedScore = 100; // score of a token contained in the row text
+    static const int CNameScore = 100;      // bonus if the token is contained in the name
+    static const int CNamePrefixScore = 50; // additional bonus if the name starts with the token
+
+    QStringList mTexts;  // lower case text of all values per row
+    QStringList mNames;  // lower case name per row
+    QHash<quint64, QVector<int>> mTrigrams;
+};
+
+class LibraryFilterModel : public QSortFilterProxyModel
+{
+    Q_OBJECT
+public:
+    LibraryFilterModel(std::shared_ptr<const LibrarySearchIndex> index, QObject *parent = nullptr);
+
+    void setFilterText(const QString &text, bool regEx);
+
+protected:
+    bool filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const override;
+    bool lessThan(const QModelIndex &left, const QModelIndex &right) const override;
+
+private:
+    std::shared_ptr<const LibrarySearchIndex> mIndex;
+    QVector<int> mRanks;
+    bool mRanked = false;
+};
+
+} // namespace modeldialog
+} // namespace studio
+} // namespace gams
+
+#endif // LIBRARYFILTERMODEL_H
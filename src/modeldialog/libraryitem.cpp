@@ -49,6 +49,11 @@ QStringList LibraryItem::files() const
     return mFiles;
 }
 
+QString LibraryItem::description() const
+{
+    return mDescription;
+}
+
 QString LibraryItem::longDescription() const
 {
     return mLongDescription;
@@ -62,6 +67,11 @@ QString LibraryItem::nameWithSuffix() const
     return name;
 }
 
+int LibraryItem::suffixNumber() const
+{
+    return mSuffixNumber;
+}
+
 } // namespace modeldialog
 } // namespace studio
 } // namespace gams
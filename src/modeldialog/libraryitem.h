@@ -36,8 +36,10 @@ public:
     QStringList values() const;
     QString name() const;
     QStringList files() const;
+    QString description() const;
     QString longDescription() const;
     QString nameWithSuffix() const;
+    int suffixNumber() const;
 
 private:
     std::shared_ptr<Library> mLibrary;
@@ -20,7 +20,8 @@
 #include "modeldialog.h"
 #include "ui_modeldialog.h"
 #include "commonpaths.h"
-#include "glbparser.h"
+#include "librarycache.h"
+#include "libraryfiltermodel.h"
 #include "libraryitem.h"
 #include "librarymodel.h"
 #include "common.h"
@@ -29,7 +30,6 @@
 #include <QMessageBox>
 #include <QTableView>
 #include <QHeaderView>
-#include <QSortFilterProxyModel>
 #include "editors/sysloglocator.h"
 #include "editors/abstractsystemlogger.h"
 #include "scheme.h"
@@ -53,9 +53,6 @@ ModelDialog::ModelDialog(QString userLibPath, QWidget *parent)
     this->setWindowFlags(this->windowFlags() & ~Qt::WindowContextHelpButtonHint);
 
     QDir gamsSysDir(CommonPaths::systemDir());
-    QList<LibraryItem> items;
-
-    GlbParser glbParser;
 
     QStringList gamsGlbFiles;
     gamsGlbFiles << "gamslib_ml/gamslib.glb"
@@ -78,18 +75,20 @@ ModelDialog::ModelDialog(QString userLibPath, QWidget *parent)
                  << "PSO Library";
 
     for (int i=0; i<gamsGlbFiles.size(); i++) {
-        if (glbParser.parseFile(gamsSysDir.filePath(gamsGlbFiles[i]))) {
-            items = glbParser.libraryItems();
-            items.at(0).library()->setName(gamsLibNames[i]);
-            addLibrary(items);
+        CachedLibrary library;
+        QString errorMessage;
+        if (LibraryCache::load(gamsSysDir.filePath(gamsGlbFiles[i]), library, errorMessage)) {
+            library.items.at(0).library()->setName(gamsLibNames[i]);
+            addLibrary(library);
         } else {
             mHasGlbErrors = true;
-            SysLogLocator::systemLog()->append(glbParser.errorMessage(),LogMsgType::Error);
+            SysLogLocator::systemLog()->append(errorMessage, LogMsgType::Error);
         }
     }
 
     if (!mUserLibPath.isEmpty())
         loadUserLibs();
+    LibraryCache::save();
 
     connect(ui->lineEdit, &QLineEdit::textChanged, this, &ModelDialog::clearSelections);
     connect(ui->tabWidget, &QTabWidget::currentChanged, this, &ModelDialog::clearSelections);
@@ -162,10 +161,11 @@ void ModelDialog::storeSelectedTab()
     mLastTabIndex = ui->tabWidget->currentIndex();
 }
 
-void ModelDialog::addLibrary(QList<LibraryItem> items, bool isUserLibrary)
+void ModelDialog::addLibrary(const CachedLibrary &library, bool isUserLibrary)
 {
+    const QList<LibraryItem> &items = library.items;
     QTableView* tableView;
-    QSortFilterProxyModel* proxyModel;
+    LibraryFilterModel* proxyModel;
 
     tableView = new QTableView();
     tableView->horizontalHeader()->setStretchLastSection(true);
@@ -178,7 +178,7 @@ void ModelDialog::addLibrary(QList<LibraryItem> items, bool isUserLibrary)
     tableView->verticalHeader()->setMinimumSectionSize(1);
     tableView->verticalHeader()->setDefaultSectionSize(int(fontMetrics().height()*TABLE_ROW_HEIGHT));
 
-    proxyModel = new QSortFilterProxyModel(this);
+    proxyModel = new LibraryFilterModel(library.searchIndex, this);
     proxyModel->setFilterKeyColumn(-1);
     proxyModel->setSourceModel(new LibraryModel(items, this));
     proxyModel->setFilterCaseSensitivity(Qt::CaseInsensitive);
@@ -209,17 +209,16 @@ void ModelDialog::addLibrary(QList<LibraryItem> items, bool isUserLibrary)
 
 void ModelDialog::loadUserLibs()
 {
-    GlbParser glbParser;
-    QDirIterator iter(mUserLibPath, QDirIterator::Subdirectories);
+    QDirIterator iter(mUserLibPath, QStringList() << "*.glb", QDir::Files, QDirIterator::Subdirectories);
     while (!iter.next().isEmpty()) {
         if (QFileInfo(iter.filePath()).suffix() == "glb") {
-            QList<LibraryItem> items;
-            if (glbParser.parseFile(iter.filePath())) {
-                items = glbParser.libraryItems();
-                addLibrary(items, true);
+            CachedLibrary library;
+            QString errorMessage;
+            if (LibraryCache::load(iter.filePath(), library, errorMessage)) {
+                addLibrary(library, true);
             } else {
                 mHasGlbErrors = true;
-                SysLogLocator::systemLog()->append(glbParser.errorMessage(),LogMsgType::Error);
+                SysLogLocator::systemLog()->append(errorMessage, LogMsgType::Error);
             }
         }
     }
@@ -248,10 +247,7 @@ void ModelDialog::on_cbRegEx_toggled(bool checked)
 
 void ModelDialog::applyFilter(QString filterString, int proxyModelIndex)
 {
-    if (ui->cbRegEx->isChecked())
-        proxyModelList[proxyModelIndex]->setFilterRegExp(filterString);
-    else
-        proxyModelList[proxyModelIndex]->setFilterWildcard(filterString);
+    proxyModelList[proxyModelIndex]->setFilterText(filterString, ui->cbRegEx->isChecked());
     this->changeHeader(proxyModelIndex);
 }
 
@@ -24,7 +24,6 @@
 #include "libraryitem.h"
 
 class QTableView;
-class QSortFilterProxyModel;
 
 namespace gams {
 namespace studio {
@@ -34,6 +33,9 @@ namespace Ui {
 class ModelDialog;
 }
 
+class LibraryFilterModel;
+struct CachedLibrary;
+
 class ModelDialog : public QDialog
 {
     Q_OBJECT
@@ -59,14 +61,14 @@ private slots:
 
 private:
     void loadUserLibs();
-    void addLibrary(QList<LibraryItem> items, bool isUserLibrary=false);
+    void addLibrary(const CachedLibrary &library, bool isUserLibrary=false);
 
 private:
     Ui::ModelDialog *ui;
     LibraryItem* mSelectedLibraryItem;
 
     QList<QTableView*> tableViewList;
-    QList<QSortFilterProxyModel*> proxyModelList;
+    QList<LibraryFilterModel*> proxyModelList;
 
     QString mUserLibPath;
     QString mIconUserLib = ":/%1/user";
@@ -43,6 +43,31 @@ QString DoubleFormatter::format(double v, DoubleFormatter::Format format, int pr
         return QString(p);
 }
 
+QStringList DoubleFormatter::format(const QVector<double> &values, DoubleFormatter::Format format, int precision, int squeeze)
+{
+    typedef char* (*FormatFunc)(double, int, int, char*, int*);
+    FormatFunc func = nullptr;
+    if (format == Format::g)
+        func = x2gfmt;
+    else if (format == Format::f)
+        func = x2fixed;
+    else if (format == Format::e)
+        func = x2efmt;
+
+    QStringList res;
+    res.reserve(values.size());
+    char outBuf[32];
+    int outLen;
+    for (double v : values) {
+        char* p = func ? func(v, precision, squeeze, outBuf, &outLen) : nullptr;
+        if (p)
+            res << QString(p);
+        else
+            res << "FORMAT_ERROR";
+    }
+    return res;
+}
+
 } // namespace numerics
 } // namespace studio
 } // namespace gams
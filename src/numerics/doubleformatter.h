@@ -21,11 +21,18 @@
 #define GAMS_STUDIO_NUMERICS_DOUBLEFORMATTER_H
 
 #include <QString>
+#include <QStringList>
+#include <QVector>
 
 namespace gams {
 namespace studio {
 namespace numerics {
 
+///
+/// \brief Formats doubles using the GAMS number formatting routines.
+/// \remark The conversion keeps its big integer workspace on the stack of each call,
+///         so all format functions can be used from several threads at once.
+///
 class DoubleFormatter
 {
 public:
@@ -36,6 +43,7 @@ public:
     };
     static int gFormatFull;
     static QString format(double v, Format format, int precision, int squeeze);
+    static QStringList format(const QVector<double> &values, Format format, int precision, int squeeze);
 
 private:
     DoubleFormatter() {};
@@ -27,8 +27,8 @@ namespace gams {
 namespace studio {
 namespace option {
 
-ConfigOptionDefinitionModel::ConfigOptionDefinitionModel(Option *data, int optionGroup, QObject *parent):
-    OptionDefinitionModel (data, optionGroup, parent)
+ConfigOptionDefinitionModel::ConfigOptionDefinitionModel(const OptionTokenizer *tokenizer, int optionGroup, QObject *parent):
+    OptionDefinitionModel (tokenizer, optionGroup, parent)
 {
     QList<QVariant> rootData;
     rootData << "Parameter" << "Synonym" << "DefValue" << "Range"
@@ -86,7 +86,7 @@ private:
     QMap<int, QVariant> mCheckState;
 
     OptionTokenizer* mOptionTokenizer;
-    Option* mOption;
+    const Option* mOption;
 };
 
 } // namepsace option
@@ -24,8 +24,8 @@ namespace gams {
 namespace studio {
 namespace option {
 
-GamsOptionDefinitionModel::GamsOptionDefinitionModel(Option *data, int optionGroup, QObject *parent):
-    OptionDefinitionModel (data, optionGroup, parent)
+GamsOptionDefinitionModel::GamsOptionDefinitionModel(const OptionTokenizer *tokenizer, int optionGroup, QObject *parent):
+    OptionDefinitionModel (tokenizer, optionGroup, parent)
 {
     QList<QVariant> rootData;
     rootData << "Parameter" << "Synonym" << "DefValue" << "Range"
@@ -77,7 +77,7 @@ private:
     QMap<int, QVariant> mCheckState;
 
     OptionTokenizer* mOptionTokenizer;
-    Option* mOption;
+    const Option* mOption;
 
     bool mTokenizerUsed;
 
@@ -20,6 +20,10 @@
 #include <QIntValidator>
 #include <QDoubleValidator>
 #include <QDir>
+#include <QMutexLocker>
+#include <QCoreApplication>
+#include <QThread>
+#include <algorithm>
 #include "exception.h"
 #include "editors/systemlogedit.h"
 #include "gclgms.h"
@@ -31,6 +35,38 @@ namespace gams {
 namespace studio {
 namespace option {
 
+QMutex OptionRegistry::mMutex;
+QMap<QString, std::shared_ptr<const Option>> OptionRegistry::mDefinitions;
+
+namespace {
+
+const OptionDefinition CEmptyDefinition;
+
+template<typename T>
+bool keyLess(const QPair<QString, T> &entry, const QString &key)
+{
+    return QString::compare(entry.first, key, Qt::CaseInsensitive) < 0;
+}
+
+template<typename T>
+const T *findKey(const QVector<QPair<QString, T>> &index, const QString &key)
+{
+    auto it = std::lower_bound(index.cbegin(), index.cend(), key, keyLess<T>);
+    if (it == index.cend() || QString::compare(it->first, key, Qt::CaseInsensitive) != 0)
+        return nullptr;
+    return &it->second;
+}
+
+template<typename T>
+void sortIndex(QVector<QPair<QString, T>> &index)
+{
+    std::sort(index.begin(), index.end(), [](const QPair<QString, T> &a, const QPair<QString, T> &b) {
+        return QString::compare(a.first, b.first, Qt::CaseInsensitive) < 0;
+    });
+}
+
+}
+
 Option::Option(const QString &systemPath, const QString &optionFileName) :
     mOptionDefinitionPath(systemPath), mOptionDefinitionFile(optionFileName)
 {
@@ -45,10 +81,10 @@ Option::~Option()
     mOptionGroup.clear();
 }
 
-void Option::dumpAll()
+void Option::dumpAll() const
 {
     qDebug() << QString("mSynonymMap.size() = %1").arg(mSynonymMap.size());
-    QMap<QString, QString>::iterator ssit;
+    QMap<QString, QString>::const_iterator ssit;
     for (ssit = mSynonymMap.begin(); ssit != mSynonymMap.end(); ++ssit)
         qDebug()  << QString("  [%1] = %2").arg(ssit.key()).arg(ssit.value());
 
@@ -92,7 +128,7 @@ void Option::dumpAll()
 
 bool Option::isValid(const QString &optionName) const
 {
-    return (mOption.contains(optionName.toUpper()) && mOption[optionName.toUpper()].valid);
+    return definition(optionName).valid;
 }
 
 bool Option::isSynonymDefined() const
@@ -102,18 +138,16 @@ bool Option::isSynonymDefined() const
 
 bool Option::isASynonym(const QString &optionName) const
 {
-    return mSynonymMap.contains( optionName.toUpper() );
+    const SynonymEntry *entry = synonymEntry(optionName);
+    return entry && !entry->name.isEmpty();
 }
 
 bool Option::isDeprecated(const QString &optionName) const
 {
-    if (mOption.contains(optionName.toUpper())) {
-        return mOption[optionName.toUpper()].deprecated;
-    } else if (mDeprecatedSynonym.contains(optionName.toUpper())) {
-        return true;
-    }
-
-    return false;
+    if (const OptionDefinition * const *def = findKey(mNameIndex, optionName))
+        return (*def)->deprecated;
+    const SynonymEntry *entry = synonymEntry(optionName);
+    return entry && entry->deprecated;
 }
 
 bool Option::isDoubleDashedOption(const QString &option) const
@@ -247,47 +281,48 @@ OptionErrorType Option::getValueErrorType(const QString &optionName, const QStri
 
 QString Option::getNameFromSynonym(const QString &synonym) const
 {
-    return mSynonymMap[synonym.toUpper()];
+    const SynonymEntry *entry = synonymEntry(synonym);
+    return entry ? entry->name : QString();
 }
 
 optOptionType Option::getOptionType(const QString &optionName) const
 {
-    return mOption[optionName.toUpper()].type;
+    return definition(optionName).type;
 }
 
 optOptionSubType Option::getOptionSubType(const QString &optionName) const
 {
-    return mOption[optionName.toUpper()].subType;
+    return definition(optionName).subType;
 }
 
 optDataType Option::getDataType(const QString &optionName) const
 {
-    return mOption[optionName.toUpper()].dataType;
+    return definition(optionName).dataType;
 }
 
 QVariant Option::getUpperBound(const QString &optionName) const
 {
-    return mOption[optionName.toUpper()].upperBound;
+    return definition(optionName).upperBound;
 }
 
 QVariant Option::getLowerBound(const QString &optionName) const
 {
-    return mOption[optionName.toUpper()].lowerBound;
+    return definition(optionName).lowerBound;
 }
 
 QVariant Option::getDefaultValue(const QString &optionName) const
 {
-    return mOption[optionName.toUpper()].defaultValue;
+    return definition(optionName).defaultValue;
 }
 
 QString Option::getDescription(const QString &optionName) const
 {
-    return mOption[optionName.toUpper()].description;
+    return definition(optionName).description;
 }
 
 QList<OptionValue> Option::getValueList(const QString &optionName) const
 {
-    return mOption[optionName.toUpper()].valueList;
+    return definition(optionName).valueList;
 }
 
 QString Option::getEOLChars() const
@@ -350,7 +385,7 @@ QStringList Option::getKeyAndSynonymList() const
 QStringList Option::getValuesList(const QString &optionName) const
 {
    QStringList valueList;
-   for ( OptionValue value: getValueList(optionName.toUpper()) )
+   for ( OptionValue value: getValueList(optionName) )
        valueList << value.value.toString();
 
    return valueList;
@@ -368,7 +403,7 @@ QStringList Option::getSynonymList(const QString &optionName) const
 QStringList Option::getNonHiddenValuesList(const QString &optionName) const
 {
     QStringList valueList;
-    for ( OptionValue value: getValueList(optionName.toUpper()) ) {
+    for ( OptionValue value: getValueList(optionName) ) {
         if (!value.hidden)
            valueList << value.value.toString();
     }
@@ -380,14 +415,14 @@ QStringList Option::getNonHiddenValuesList(const QString &optionName) const
 int Option::getOrdinalNumber(const QString &optionName) const
 {
     if (isValid(optionName))
-        return mOption[optionName.toUpper()].number;
+        return definition(optionName).number;
     else
         return -1;
 }
 
 int Option::getGroupNumber(const QString &optionName) const
 {
-    return mOption[optionName.toUpper()].groupNumber;
+    return definition(optionName).groupNumber;
 }
 
 bool Option::isGroupHidden(int number) const
@@ -430,28 +465,11 @@ bool Option::available() const
     return mAvailable;
 }
 
-QMap<QString, OptionDefinition> Option::getOption() const
+const QMap<QString, OptionDefinition> &Option::getOption() const
 {
     return mOption;
 }
 
-bool Option::isModified(const QString &optionName) const
-{
-    return mOption[optionName.toUpper()].modified;
-}
-
-void Option::setModified(const QString &optionName, bool modified)
-{
-    mOption[optionName.toUpper()].modified = modified;
-}
-
-void Option::resetModficationFlag()
-{
-    for( QMap<QString, OptionDefinition>::iterator it=mOption.begin(); it!=mOption.end(); ++it) {
-        it.value().modified = false;
-    }
-}
-
 QString Option::getOptionDefinitionFile() const
 {
     return mOptionDefinitionFile;
@@ -464,7 +482,7 @@ QString Option::getOptionDefinitionPath() const
 
 OptionDefinition Option::getOptionDefinition(const QString &optionName) const
 {
-    return mOption[optionName.toUpper()];
+    return definition(optionName);
 }
 
 bool Option::readDefinitionFile(const QString &systemPath, const QString &optionFileName)
@@ -477,6 +495,7 @@ bool Option::readDefinitionFile(const QString &systemPath, const QString &option
     optSetErrorCallback(Option::errorCallback);
 
     optHandle_t mOPTHandle;
+    QStringList deprecatedSynonym;
 
     char msg[GMS_SSSIZE];
     if (!optCreateD(&mOPTHandle, systemPath.toLatin1(), msg, sizeof(msg)))
@@ -496,7 +515,7 @@ bool Option::readDefinitionFile(const QString &systemPath, const QString &option
              optGetSynonym(mOPTHandle, i, syn, name);
              synonym.insertMulti(QString::fromLatin1(name), QString::fromLatin1(syn));
              if (optIsDeprecated(mOPTHandle, syn))
-                mDeprecatedSynonym << QString::fromLatin1(syn).toUpper();
+                deprecatedSynonym << QString::fromLatin1(syn).toUpper();
          }
 
          for (int i=1; i <= optGroupCount(mOPTHandle); ++i) {
@@ -558,7 +577,7 @@ bool Option::readDefinitionFile(const QString &systemPath, const QString &option
              if (synonym.contains(nameStr)) {
                  QMap<QString, QString>::const_iterator it = synonym.find(nameStr);
                  while (it != synonym.end() && (QString::compare(it.key(), nameStr, Qt::CaseInsensitive) == 0) ) {
-                       if (!isDeprecated(it.value()))
+                       if (!deprecatedSynonym.contains(it.value().toUpper()))
                           synonymList << it.value();
                        mSynonymMap.insertMulti(it.value().toUpper(), it.key());
                        ++it;
@@ -643,6 +662,7 @@ bool Option::readDefinitionFile(const QString &systemPath, const QString &option
              mOption[nameStr.toUpper()] = opt;
          }
          optFree(&mOPTHandle);
+         buildIndex(deprecatedSynonym);
          return true;
      } else {
 
@@ -654,15 +674,72 @@ bool Option::readDefinitionFile(const QString &systemPath, const QString &option
 
 }
 
+void Option::buildIndex(const QStringList &deprecatedSynonyms)
+{
+    mNameIndex.clear();
+    mNameIndex.reserve(mOption.size());
+    for (auto it = mOption.cbegin(); it != mOption.cend(); ++it)
+        mNameIndex << qMakePair(it.key(), &it.value());
+    sortIndex(mNameIndex);
+
+    // a multi-key lookup in mSynonymMap returns the most recently inserted name, which is the first in iteration order
+    QMap<QString, SynonymEntry> synonyms;
+    for (auto it = mSynonymMap.cbegin(); it != mSynonymMap.cend(); ++it) {
+        if (!synonyms.contains(it.key()))
+            synonyms[it.key()].name = it.value();
+    }
+    for (const QString &synonym : deprecatedSynonyms)
+        synonyms[synonym].deprecated = true;
+
+    mSynonymIndex.clear();
+    mSynonymIndex.reserve(synonyms.size());
+    for (auto it = synonyms.cbegin(); it != synonyms.cend(); ++it)
+        mSynonymIndex << qMakePair(it.key(), it.value());
+    sortIndex(mSynonymIndex);
+}
+
+const OptionDefinition &Option::definition(const QString &optionName) const
+{
+    const OptionDefinition * const *def = findKey(mNameIndex, optionName);
+    return def ? **def : CEmptyDefinition;
+}
+
+const Option::SynonymEntry *Option::synonymEntry(const QString &synonym) const
+{
+    return findKey(mSynonymIndex, synonym);
+}
+
 int Option::errorCallback(int count, const char *message)
 {
     Q_UNUSED(count);
-    auto logger = SysLogLocator::systemLog();
-    logger->append(InvalidGAMS, LogMsgType::Error);
-    logger->append(message, LogMsgType::Error);
+    // the opt library calls back on the thread that parses, but the system log is only accessed on the GUI thread
+    QString text = QString::fromLatin1(message);
+    auto log = [text]() {
+        auto logger = SysLogLocator::systemLog();
+        logger->append(InvalidGAMS, LogMsgType::Error);
+        logger->append(text, LogMsgType::Error);
+    };
+    if (!qApp || QThread::currentThread() == qApp->thread())
+        log();
+    else
+        QMetaObject::invokeMethod(qApp, log, Qt::QueuedConnection);
     return 0;
 }
 
+std::shared_ptr<const Option> OptionRegistry::definition(const QString &systemPath, const QString &optionFileName)
+{
+    QString key = QDir(systemPath).filePath(optionFileName);
+    QMutexLocker locker(&mMutex);
+    std::shared_ptr<const Option> option = mDefinitions.value(key);
+    if (!option) {
+        option = std::make_shared<Option>(systemPath, optionFileName);
+        // failed reads aren't cached so the error is reported again on the next attempt
+        if (option->available())
+            mDefinitions.insert(key, option);
+    }
+    return option;
+}
+
 } // namespace option
 } // namespace studio
 } // namespace gams
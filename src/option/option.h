@@ -20,9 +20,12 @@
 #ifndef OPTION_H
 #define OPTION_H
 
+#include <memory>
 #include <QStringList>
 #include <QMap>
+#include <QMutex>
 #include <QVariant>
+#include <QVector>
 #include "optcc.h"
 
 namespace gams {
@@ -150,7 +153,6 @@ struct OptionDefinition {
     QVariant upperBound;
     QList<OptionValue> valueList;
     int groupNumber;
-    bool modified = false;
 };
 
 class Option
@@ -161,7 +163,7 @@ public:
     Option(const QString &systemPath, const QString &optionFileName);
     ~Option();
 
-    void dumpAll();
+    void dumpAll() const;
 
     bool isValid(const QString &optionName) const;
     bool isSynonymDefined() const;
@@ -212,11 +214,7 @@ public:
 
     bool available() const;
 
-    QMap<QString, OptionDefinition> getOption() const;
-
-    bool isModified(const QString &optionName) const;
-    void setModified(const QString &optionName, bool modified);
-    void resetModficationFlag();
+    const QMap<QString, OptionDefinition> &getOption() const;
 
     QString getOptionDefinitionFile() const;
     QString getOptionDefinitionPath() const;
@@ -224,6 +222,11 @@ public:
     static int errorCallback(int count, const char *message);
 
 private:
+    struct SynonymEntry {
+        QString name;
+        bool deprecated = false;
+    };
+
     QString mOptionDefinitionPath;
     QString mOptionDefinitionFile;
 
@@ -232,13 +235,31 @@ private:
     QString mStringquote;
 
     QMap<QString, OptionDefinition> mOption;
-    QStringList mDeprecatedSynonym;
     QMap<QString, QString> mSynonymMap;
     QMap<int, QString> mOptionTypeNameMap;
     QMap<int, OptionGroup> mOptionGroup;
 
+    // case-insensitively sorted lookup tables, built once after reading the definition file
+    QVector<QPair<QString, const OptionDefinition*>> mNameIndex;
+    QVector<QPair<QString, SynonymEntry>> mSynonymIndex;
+
     bool mAvailable;
     bool readDefinitionFile(const QString &systemPath, const QString &optionFileName);
+    void buildIndex(const QStringList &deprecatedSynonyms);
+    const OptionDefinition &definition(const QString &optionName) const;
+    const SynonymEntry *synonymEntry(const QString &synonym) const;
+};
+
+// Process-wide cache of parsed option definition files. Each file is read once and shared
+// read-only by all tokenizers of that solver.
+class OptionRegistry
+{
+public:
+    static std::shared_ptr<const Option> definition(const QString &systemPath, const QString &optionFileName);
+
+private:
+    static QMutex mMutex;
+    static QMap<QString, std::shared_ptr<const Option>> mDefinitions;
 };
 
 const double OPTION_VALUE_MAXDOUBLE = 1e+299;
@@ -52,7 +52,7 @@ private slots:
 
 private:
     OptionTokenizer* mOptionTokenizer;
-    Option* mOption;
+    const Option* mOption;
     QModelIndex mCurrentEditedIndex;
 };
 
@@ -21,14 +21,15 @@
 #include <QApplication>
 #include <QPalette>
 #include "optiondefinitionmodel.h"
+#include "optiontokenizer.h"
 #include "scheme.h"
 
 namespace gams {
 namespace studio {
 namespace option {
 
-OptionDefinitionModel::OptionDefinitionModel(Option* data, int optionGroup, QObject* parent)
-    : QAbstractItemModel(parent), mOptionGroup(optionGroup), mOption(data)
+OptionDefinitionModel::OptionDefinitionModel(const OptionTokenizer* tokenizer, int optionGroup, QObject* parent)
+    : QAbstractItemModel(parent), mOptionGroup(optionGroup), mOption(tokenizer->getOption()), mTokenizer(tokenizer)
 {
 }
 
@@ -236,12 +237,13 @@ int OptionDefinitionModel::rowCount(const QModelIndex& parent) const
     return parentItem->childCount();
 }
 
-void OptionDefinitionModel::setupTreeItemModelData(Option* option, OptionDefinitionItem* parent)
+void OptionDefinitionModel::setupTreeItemModelData(const Option* option, OptionDefinitionItem* parent)
 {
     QList<OptionDefinitionItem*> parents;
     parents << parent;
 
-    for(auto it = option->getOption().cbegin(); it != option->getOption().cend(); ++it)  {
+    const QMap<QString, OptionDefinition> &definitions = option->getOption();
+    for(auto it = definitions.cbegin(); it != definitions.cend(); ++it)  {
         OptionDefinition optdef =  it.value();
 
         if ((optdef.deprecated) || (!optdef.valid))
@@ -372,7 +374,7 @@ void OptionDefinitionModel::setupTreeItemModelData(Option* option, OptionDefinit
         columnData.append(optdef.description);
         columnData.append(optdef.number);
         OptionDefinitionItem* item = new OptionDefinitionItem(columnData, parents.last());
-        item->setModified(optdef.modified);
+        item->setModified(mTokenizer->isModified(optdef.name));
 
         parents.last()->appendChild(item);
 
@@ -30,11 +30,13 @@ namespace gams {
 namespace studio {
 namespace option {
 
+class OptionTokenizer;
+
 class OptionDefinitionModel : public QAbstractItemModel
 {
     Q_OBJECT
 public:
-    OptionDefinitionModel(Option* data, int optionGroup=0, QObject* parent=nullptr);
+    OptionDefinitionModel(const OptionTokenizer* tokenizer, int optionGroup=0, QObject* parent=nullptr);
     ~OptionDefinitionModel() override;
 
     QVariant data(const QModelIndex& index, int role) const override;
@@ -74,10 +76,11 @@ public slots:
     void loadOptionFromGroup(const int group);
 
 protected:
-    void setupTreeItemModelData(Option* option, OptionDefinitionItem* parent);
+    void setupTreeItemModelData(const Option* option, OptionDefinitionItem* parent);
 
     int mOptionGroup;
-    Option* mOption;
+    const Option* mOption;
+    const OptionTokenizer* mTokenizer;  // holds the modification state of the options of the edited file
     OptionDefinitionItem *rootItem;
 };
 
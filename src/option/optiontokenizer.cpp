@@ -44,7 +44,7 @@ QString OptionTokenizer::commentGeneratedStr = QString("[COMMENT]");
 OptionTokenizer::OptionTokenizer(const QString &optionDefFileName)
 {
     // option definition
-    mOption = new Option(CommonPaths::systemDir(), optionDefFileName);
+    mOption = OptionRegistry::definition(CommonPaths::systemDir(), optionDefFileName);
     mOPTAvailable = mOption->available();
 
     if (mOPTAvailable) {
@@ -100,8 +100,6 @@ OptionTokenizer::~OptionTokenizer()
 {
     if (mOptionLogger)
         delete mOptionLogger;
-    if (mOption)
-        delete mOption;
     if (mOPTAvailable && mOPTHandle)
        optFree(&mOPTHandle);
 }
@@ -751,7 +749,7 @@ bool OptionTokenizer::getOptionItemFromStr(SolverOptionItem *item, bool firstTim
                                    ? errorType : OptionErrorType::Value_Out_Of_Range;
                     item->disabled = false;
 
-                    mOption->setModified(QString::fromLatin1(name), true);
+                    setModified(QString::fromLatin1(name), true);
                     break;
                }
            }
@@ -1035,7 +1033,7 @@ bool OptionTokenizer::updateOptionItem(const QString &key, const QString &value,
                    else
                        item->error = OptionErrorType::Value_Out_Of_Range;
 
-                   mOption->setModified(QString::fromLatin1(name), true);
+                   setModified(QString::fromLatin1(name), true);
                }
                break;
            }
@@ -1313,7 +1311,7 @@ bool OptionTokenizer::writeOptionFile(const QList<SolverOptionItem *> &items, co
 
 void OptionTokenizer::validateOption(QList<OptionItem> &items)
 {
-   mOption->resetModficationFlag();
+   resetModficationFlag();
    QList<int> idList;
    for(OptionItem& item : items) {
        idList << item.optionId;
@@ -1331,7 +1329,7 @@ void OptionTokenizer::validateOption(QList<OptionItem> &items)
            } else { // valid and not deprected Option
                item.error = mOption->getValueErrorType(item.key, item.value);
            }
-           mOption->setModified(item.key, true);
+           setModified(item.key, true);
        } else { // invalid option
            item.error = OptionErrorType::Invalid_Key;
        }
@@ -1348,7 +1346,7 @@ void OptionTokenizer::validateOption(QList<OptionItem> &items)
 
 void OptionTokenizer::validateOption(QList<SolverOptionItem *> &items)
 {
-    mOption->resetModficationFlag();
+    resetModficationFlag();
     QList<int> idList;
     for(SolverOptionItem* item : items) {
         if (item->disabled)
@@ -1370,7 +1368,7 @@ void OptionTokenizer::validateOption(QList<SolverOptionItem *> &items)
 
 void OptionTokenizer::validateOption(QList<ParamConfigItem *> &items)
 {
-    mOption->resetModficationFlag();
+    resetModficationFlag();
     QList<int> idList;
     for(ParamConfigItem* item : items) {
         if (item->disabled)
@@ -1397,7 +1395,7 @@ void OptionTokenizer::validateOption(QList<ParamConfigItem *> &items)
                     }
                 }
             }
-            mOption->setModified(item->key, true);
+            setModified(item->key, true);
         } else { // invalid option
              item->error = OptionErrorType::Invalid_Key;
         }
@@ -1410,9 +1408,27 @@ void OptionTokenizer::validateOption(QList<ParamConfigItem *> &items)
     }
 }
 
-Option *OptionTokenizer::getOption() const
+const Option *OptionTokenizer::getOption() const
 {
-    return mOption;
+    return mOption.get();
+}
+
+bool OptionTokenizer::isModified(const QString &optionName) const
+{
+    return mModifiedOptions.contains(optionName.toUpper());
+}
+
+void OptionTokenizer::setModified(const QString &optionName, bool modified)
+{
+    if (modified)
+        mModifiedOptions.insert(optionName.toUpper());
+    else
+        mModifiedOptions.remove(optionName.toUpper());
+}
+
+void OptionTokenizer::resetModficationFlag()
+{
+    mModifiedOptions.clear();
 }
 
 AbstractSystemLogger *OptionTokenizer::logger()
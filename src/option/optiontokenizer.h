@@ -23,6 +23,7 @@
 #include <QTextLayout>
 #include <QLineEdit>
 #include <QTextCodec>
+#include <QSet>
 
 #include "option.h"
 #include "editors/abstractsystemlogger.h"
@@ -83,7 +84,11 @@ public:
     void validateOption(QList<SolverOptionItem *> &items);
     void validateOption(QList<ParamConfigItem *> &items);
 
-    Option *getOption() const;
+    const Option *getOption() const;
+
+    bool isModified(const QString &optionName) const;
+    void setModified(const QString &optionName, bool modified);
+    void resetModficationFlag();
 
     AbstractSystemLogger* logger();
     void provideLogger(AbstractSystemLogger* optionLogEdit);
@@ -101,7 +106,8 @@ public slots:
     void formatItemLineEdit(QLineEdit* lineEdit, const QList<OptionItem> &optionItems);
 
 private:
-    Option* mOption = nullptr;
+    std::shared_ptr<const Option> mOption;
+    QSet<QString> mModifiedOptions;
     optHandle_t mOPTHandle;
     bool mOPTAvailable = false;
     QStringList mLineComments;
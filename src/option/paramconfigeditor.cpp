@@ -110,7 +110,7 @@ void ParamConfigEditor::init(const QList<ConfigItem *> &initParamItems)
     ui->ParamCfgTableView->resizeColumnToContents(ConfigParamTableModel::COLUMN_MAX_VERSION);
 
     QSortFilterProxyModel* proxymodel = new OptionSortFilterProxyModel(this);
-    ConfigOptionDefinitionModel* optdefmodel =  new ConfigOptionDefinitionModel(mOptionTokenizer->getOption(), 0, this);
+    ConfigOptionDefinitionModel* optdefmodel =  new ConfigOptionDefinitionModel(mOptionTokenizer, 0, this);
     proxymodel->setFilterKeyColumn(-1);
     proxymodel->setSourceModel( optdefmodel );
     proxymodel->setFilterCaseSensitivity(Qt::CaseInsensitive);
@@ -624,7 +624,7 @@ void ParamConfigEditor::addParameterFromDefinition(const QModelIndex &index)
     ui->ParamCfgTableView->selectionModel()->clearSelection();
 //    QString synonymData = ui->ParamCfgDefTreeView->model()->data(synonymIndex).toString();
     QString selectedValueData = ui->ParamCfgDefTreeView->model()->data(selectedValueIndex).toString();
-    mOptionTokenizer->getOption()->setModified(optionNameData, true);
+    mOptionTokenizer->setModified(optionNameData, true);
     ui->ParamCfgDefTreeView->model()->setData(optionNameIndex, Qt::CheckState(Qt::Checked), Qt::CheckStateRole);
 
     // insert option row
@@ -845,7 +845,7 @@ void ParamConfigEditor::on_newTableRowDropped(const QModelIndex &index)
     QModelIndexList definitionItems = ui->ParamCfgDefTreeView->model()->match(ui->ParamCfgDefTreeView->model()->index(0, OptionDefinitionModel::COLUMN_OPTION_NAME),
                                                                      Qt::DisplayRole,
                                                                      optionName, 1);
-    mOptionTokenizer->getOption()->setModified(optionName, true);
+    mOptionTokenizer->setModified(optionName, true);
     for(QModelIndex item : definitionItems) {
         ui->ParamCfgDefTreeView->model()->setData(item, Qt::CheckState(Qt::Checked), Qt::CheckStateRole);
     }
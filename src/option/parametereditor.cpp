@@ -105,7 +105,7 @@ ParameterEditor::ParameterEditor(QAction *aRun, QAction *aRunGDX, QAction *aComp
     connect(mParameterTableModel, &GamsParameterTableModel::optionValueChanged, this, &ParameterEditor::on_parameterValueChanged, Qt::UniqueConnection);
 
     QSortFilterProxyModel* proxymodel = new OptionSortFilterProxyModel(this);
-    GamsOptionDefinitionModel* optdefmodel =  new GamsOptionDefinitionModel(mOptionTokenizer->getOption(), 0, this);
+    GamsOptionDefinitionModel* optdefmodel =  new GamsOptionDefinitionModel(mOptionTokenizer, 0, this);
     proxymodel->setFilterKeyColumn(-1);
     proxymodel->setSourceModel( optdefmodel );
     proxymodel->setFilterCaseSensitivity(Qt::CaseInsensitive);
@@ -727,7 +727,7 @@ void ParameterEditor::deleteAllParameters()
     if (!mExtendedEditor->isVisible() || !ui->gamsParameterTableView->hasFocus() || ui->gamsParameterTableView->model()->rowCount() <= 0)
         return;
 
-    mOptionTokenizer->getOption()->resetModficationFlag();
+    mOptionTokenizer->resetModficationFlag();
 
     QModelIndexList items = ui->gamsParameterTreeView->model()->match(ui->gamsParameterTreeView->model()->index(0, OptionDefinitionModel::COLUMN_OPTION_NAME),
                                                                      Qt::CheckStateRole,
@@ -874,7 +874,7 @@ void ParameterEditor::on_newTableRowDropped(const QModelIndex &index)
     QModelIndexList definitionItems = ui->gamsParameterTreeView->model()->match(ui->gamsParameterTreeView->model()->index(0, OptionDefinitionModel::COLUMN_OPTION_NAME),
                                                                      Qt::DisplayRole,
                                                                      optionName, 1);
-    mOptionTokenizer->getOption()->setModified(optionName, true);
+    mOptionTokenizer->setModified(optionName, true);
     for(QModelIndex item : definitionItems) {
         ui->gamsParameterTreeView->model()->setData(item, Qt::CheckState(Qt::Checked), Qt::CheckStateRole);
     }
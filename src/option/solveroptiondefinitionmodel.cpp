@@ -25,8 +25,8 @@ namespace gams {
 namespace studio {
 namespace option {
 
-SolverOptionDefinitionModel::SolverOptionDefinitionModel(Option *data, int optionGroup, QObject *parent):
-    OptionDefinitionModel (data, optionGroup, parent)
+SolverOptionDefinitionModel::SolverOptionDefinitionModel(const OptionTokenizer *tokenizer, int optionGroup, QObject *parent):
+    OptionDefinitionModel (tokenizer, optionGroup, parent)
 {
     QList<QVariant> rootData;
     rootData << "Option" << "Synonym" << "DefValue" << "Range"
@@ -104,9 +104,8 @@ void SolverOptionDefinitionModel::modifyOptionDefinitionItem(const SolverOptionI
         OptionDefinitionItem* nodeItem = static_cast<OptionDefinitionItem*>(node.internalPointer());
         OptionDefinitionItem *parentItem = nodeItem->parentItem();
         if (parentItem == rootItem) {
-            OptionDefinition optdef = mOption->getOptionDefinition(nodeItem->data(OptionDefinitionModel::COLUMN_OPTION_NAME).toString());
-            optdef.modified = !optionItem->disabled;
-            setData(node, optdef.modified ? Qt::CheckState(Qt::Checked) : Qt::CheckState(Qt::Unchecked), Qt::CheckStateRole );
+            bool modified = !optionItem->disabled;
+            setData(node, modified ? Qt::CheckState(Qt::Checked) : Qt::CheckState(Qt::Unchecked), Qt::CheckStateRole );
         }
     }
     endResetModel();
@@ -129,11 +128,8 @@ void SolverOptionDefinitionModel::modifyOptionDefinition(const QList<SolverOptio
         OptionDefinitionItem *parentItem = item->parentItem();
         if (parentItem == rootItem) {
             OptionDefinition optdef = mOption->getOptionDefinition(item->data(OptionDefinitionModel::COLUMN_OPTION_NAME).toString());
-            if (ids.contains(optdef.number))
-                optdef.modified = true;
-            else
-                optdef.modified = false;
-            setData(node, optdef.modified ? Qt::CheckState(Qt::Checked) : Qt::CheckState(Qt::Unchecked), Qt::CheckStateRole );
+            bool modified = ids.contains(optdef.number);
+            setData(node, modified ? Qt::CheckState(Qt::Checked) : Qt::CheckState(Qt::Unchecked), Qt::CheckStateRole );
         }
     }
     endResetModel();
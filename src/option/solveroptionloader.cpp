@@ -0,0 +1,123 @@
+/*
+ * This file is part of the GAMS Studio project.
+ *
+ * Copyright (c) 2017-2020 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2020 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "solveroptionloader.h"
+#include "optiontokenizer.h"
+
+#include <QFile>
+#include <QMutexLocker>
+#include <QTextStream>
+#include <QThread>
+
+namespace gams {
+namespace studio {
+namespace option {
+
+namespace {
+
+// collects the tokenizer messages of the worker thread, they are logged when the items are handed over
+class MessageBuffer : public AbstractSystemLogger
+{
+public:
+    void append(const QString &msg, LogMsgType type) override {
+        messages << OptionMessage(msg, type);
+    }
+    QList<OptionMessage> messages;
+};
+
+inline QList<OptionMessage> &bufferedMessages(AbstractSystemLogger *buffer)
+{
+    return static_cast<MessageBuffer*>(buffer)->messages;
+}
+
+}
+
+SolverOptionLoader::SolverOptionLoader(OptionTokenizer *tokenizer, const QString &location, QTextCodec *codec)
+    : QObject(), mTokenizer(tokenizer), mMessageBuffer(new MessageBuffer()), mLocation(location), mCodec(codec)
+{
+    mTokenizer->provideLogger(mMessageBuffer);
+}
+
+SolverOptionLoader::~SolverOptionLoader()
+{
+    qDeleteAll(mItems);
+    delete mTokenizer;
+    delete mMessageBuffer;
+}
+
+void SolverOptionLoader::takeLoaded(QList<SolverOptionItem *> &items, QList<OptionMessage> &messages)
+{
+    QMutexLocker locker(&mMutex);
+    items = mItems;
+    messages = mMessages;
+    mItems.clear();
+    mMessages.clear();
+}
+
+bool SolverOptionLoader::isFinished()
+{
+    QMutexLocker locker(&mMutex);
+    return mFinished;
+}
+
+void SolverOptionLoader::load()
+{
+    bool available = mTokenizer->getOption()->available();
+    QList<OptionMessage> &messages = bufferedMessages(mMessageBuffer);
+
+    QList<SolverOptionItem *> items;
+    QFile inputFile(mLocation);
+    if (inputFile.open(QIODevice::ReadOnly)) {
+        QTextStream in(&inputFile);
+        in.setCodec(mCodec);
+        while (!in.atEnd()) {
+            if (QThread::currentThread()->isInterruptionRequested())
+                break;
+            SolverOptionItem* item = new SolverOptionItem();
+            if (available)
+                mTokenizer->getOptionItemFromStr(item, true, in.readLine());
+            else
+                item->key = in.readLine();
+            items << item;
+            if (items.size() >= CItemsPerBatch)
+                publish(items, messages, false);
+        }
+        inputFile.close();
+    }
+    publish(items, messages, true);
+}
+
+void SolverOptionLoader::publish(QList<SolverOptionItem *> &items, QList<OptionMessage> &messages, bool done)
+{
+    {
+        QMutexLocker locker(&mMutex);
+        mItems << items;
+        mMessages << messages;
+        mFinished = done;
+    }
+    items.clear();
+    messages.clear();
+    emit itemsAvailable();
+    if (done)
+        emit finished();
+}
+
+} // namespace option
+} // namespace studio
+} // namespace gams
@@ -0,0 +1,80 @@
+/*
+ * This file is part of the GAMS Studio project.
+ *
+ * Copyright (c) 2017-2020 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2020 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef SOLVEROPTIONLOADER_H
+#define SOLVEROPTIONLOADER_H
+
+#include <QMutex>
+#include <QObject>
+#include <QPair>
+
+#include "option.h"
+#include "editors/abstractsystemlogger.h"
+
+class QTextCodec;
+
+namespace gams {
+namespace studio {
+namespace option {
+
+typedef QPair<QString, LogMsgType> OptionMessage;
+
+class OptionTokenizer;
+
+// Reads and validates a solver option file on a worker thread. The loader takes over an OptionTokenizer (and
+// with it its own option handle) that has been created on the GUI thread, only the parsing of the lines runs on
+// the worker. The validated items are handed over in batches.
+class SolverOptionLoader : public QObject
+{
+    Q_OBJECT
+public:
+    SolverOptionLoader(OptionTokenizer *tokenizer, const QString &location, QTextCodec *codec);
+    ~SolverOptionLoader() override;
+
+    void takeLoaded(QList<SolverOptionItem *> &items, QList<OptionMessage> &messages);
+    bool isFinished();
+
+public slots:
+    void load();
+
+signals:
+    void itemsAvailable();
+    void finished();
+
+private:
+    static const int CItemsPerBatch = 500; // number of lines validated before they are handed over
+
+    void publish(QList<SolverOptionItem *> &items, QList<OptionMessage> &messages, bool done);
+
+    OptionTokenizer *mTokenizer;
+    AbstractSystemLogger *mMessageBuffer;
+    QString mLocation;
+    QTextCodec *mCodec;
+
+    QMutex mMutex;
+    QList<SolverOptionItem *> mItems;
+    QList<OptionMessage> mMessages;
+    bool mFinished = false;
+};
+
+} // namespace option
+} // namespace studio
+} // namespace gams
+
+#endif // SOLVEROPTIONLOADER_H
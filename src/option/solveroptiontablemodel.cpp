@@ -20,6 +20,7 @@
 
 #include <QMessageBox>
 #include <QApplication>
+#include <QHash>
 
 #include "solveroptiontablemodel.h"
 #include "settings.h"
@@ -649,6 +650,28 @@ void SolverOptionTableModel::reloadSolverOptionModel(const QList<SolverOptionIte
     connect(this, &QAbstractTableModel::dataChanged, this, &SolverOptionTableModel::on_updateSolverOptionItem);
 }
 
+void SolverOptionTableModel::appendSolverOptionItems(const QList<SolverOptionItem *> &optionItem)
+{
+    if (optionItem.isEmpty())
+        return;
+
+    int first = mOptionItem.size();
+    beginInsertRows(QModelIndex(), first, first + optionItem.size() - 1);
+    mOptionItem.append(optionItem);
+    for (int i = first; i < mOptionItem.size(); ++i) {
+        if (mOptionItem.at(i)->disabled)
+            mCheckState[i] = QVariant(Qt::PartiallyChecked);
+        else if (mOptionItem.at(i)->error == OptionErrorType::No_Error)
+            mCheckState[i] = QVariant(Qt::Unchecked);
+        else
+            mCheckState[i] = QVariant(Qt::Checked);
+    }
+    endInsertRows();
+
+    emit solverOptionModelChanged(mOptionItem);
+    updateRecurrentStatus();
+}
+
 void SolverOptionTableModel::on_updateSolverOptionItem(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QVector<int> &roles)
 {
     QModelIndex idx = topLeft;
@@ -690,6 +713,7 @@ void SolverOptionTableModel::on_updateSolverOptionItem(const QModelIndex &topLef
 
 void SolverOptionTableModel::on_removeSolverOptionItem()
 {
+    // the removed row may have been the duplicate of a remaining one, so its errors have to be revalidated
     beginResetModel();
     mOptionTokenizer->validateOption(mOptionItem);
 
@@ -768,12 +792,13 @@ void SolverOptionTableModel::on_toggleRowHeader(int logicalIndex)
 
 void SolverOptionTableModel::updateRecurrentStatus()
 {
-    QList<int> idList;
+    QHash<int, int> idCount;
     for(SolverOptionItem* item : mOptionItem) {
-        idList << item->optionId;
+        if (item->optionId != -1)
+            ++idCount[item->optionId];
     }
     for(SolverOptionItem* item : mOptionItem) {
-        item->recurrent = (!item->disabled && item->optionId != -1 && idList.count(item->optionId) > 1);
+        item->recurrent = (!item->disabled && item->optionId != -1 && idCount.value(item->optionId) > 1);
     }
     headerDataChanged(Qt::Vertical, 0, mOptionItem.size());
 }
@@ -78,6 +78,7 @@ signals:
 
 public slots:
     void reloadSolverOptionModel(const QList<SolverOptionItem *> &optionItem);
+    void appendSolverOptionItems(const QList<SolverOptionItem *> &optionItem);
     void on_updateSolverOptionItem(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QVector<int> &roles);
     void on_removeSolverOptionItem();
     void on_toggleRowHeader(int logicalIndex);
@@ -89,7 +90,7 @@ private:
     QMap<int, QVariant> mCheckState;
 
     OptionTokenizer* mOptionTokenizer;
-    Option* mOption;
+    const Option* mOption;
 
     void setRowCount(int rows);
     void updateCheckState();
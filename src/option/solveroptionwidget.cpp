@@ -30,6 +30,7 @@
 #include "definitionitemdelegate.h"
 #include "optionsortfilterproxymodel.h"
 #include "solveroptiondefinitionmodel.h"
+#include "solveroptionloader.h"
 #include "mainwindow.h"
 #include "editors/systemlogedit.h"
 #include "settings.h"
@@ -57,6 +58,7 @@ SolverOptionWidget::SolverOptionWidget(QString solverName, QString optionFilePat
 
 SolverOptionWidget::~SolverOptionWidget()
 {
+    stopLoading();
     delete ui;
     delete mOptionTokenizer;
     delete mOptionCompleter;
@@ -65,6 +67,7 @@ SolverOptionWidget::~SolverOptionWidget()
 
 bool SolverOptionWidget::init(const QString &optDefFileName)
 {
+    mOptDefFileName = optDefFileName;
     mOptionTokenizer = new OptionTokenizer(optDefFileName);
     if (!mOptionTokenizer->getOption()->available())
        EXCEPT() << "Could not find or load OPT library for opening '" << mLocation << "'. Please check your GAMS installation.";
@@ -73,8 +76,8 @@ bool SolverOptionWidget::init(const QString &optDefFileName)
     mOptionTokenizer->provideLogger(logEdit);
     ui->solverOptionTabWidget->addTab( logEdit, "Messages" );
 
-    QList<SolverOptionItem *> optionItem = mOptionTokenizer->readOptionFile(mLocation, mCodec);
-    mOptionTableModel = new SolverOptionTableModel(optionItem, mOptionTokenizer,  this);
+    // the option file is read and validated in the background and streamed into the model, see loadOptionFile()
+    mOptionTableModel = new SolverOptionTableModel(QList<SolverOptionItem *>(), mOptionTokenizer,  this);
     ui->solverOptionTableView->setModel( mOptionTableModel );
     updateTableColumnSpan();
 
@@ -139,7 +142,7 @@ bool SolverOptionWidget::init(const QString &optDefFileName)
     ui->solverOptionGroup->setModelColumn(0);
 
     OptionSortFilterProxyModel* proxymodel = new OptionSortFilterProxyModel(this);
-    SolverOptionDefinitionModel* optdefmodel =  new SolverOptionDefinitionModel(mOptionTokenizer->getOption(), 0, this);
+    SolverOptionDefinitionModel* optdefmodel =  new SolverOptionDefinitionModel(mOptionTokenizer, 0, this);
     proxymodel->setFilterKeyColumn(-1);
     proxymodel->setSourceModel( optdefmodel );
     proxymodel->setFilterCaseSensitivity(Qt::CaseInsensitive);
@@ -216,6 +219,7 @@ bool SolverOptionWidget::init(const QString &optDefFileName)
         connect(this, &SolverOptionWidget::compactViewChanged, optdefmodel, &SolverOptionDefinitionModel::on_compactViewChanged, Qt::UniqueConnection);
 
         mOptionTokenizer->logger()->append(QString("Loading options from %1").arg(mLocation), LogMsgType::Info);
+        loadOptionFile(mCodec);
         return true;
     }
 }
@@ -454,7 +458,7 @@ void SolverOptionWidget::addOptionFromDefinition(const QModelIndex &index)
     ui->solverOptionTableView->selectionModel()->clearSelection();
 //    QString synonymData = ui->solverOptionTreeView->model()->data(synonymIndex).toString();
     QString selectedValueData = ui->solverOptionTreeView->model()->data(selectedValueIndex).toString();
-    mOptionTokenizer->getOption()->setModified(optionNameData, true);
+    mOptionTokenizer->setModified(optionNameData, true);
     ui->solverOptionTreeView->model()->setData(optionNameIndex, Qt::CheckState(Qt::Checked), Qt::CheckStateRole);
 
     if (settings && settings->toBool(skSoAddCommentAbove)) { // insert comment description row
@@ -598,7 +602,7 @@ void SolverOptionWidget::on_reloadSolverOptionFile(QTextCodec* codec)
      else
          return;
      mCodec = codec;
-     mOptionTableModel->reloadSolverOptionModel( mOptionTokenizer->readOptionFile(mLocation, codec) );
+     loadOptionFile(codec);
      mFileHasChangedExtern = false;
      setModified(false);
 }
@@ -1401,6 +1405,76 @@ void SolverOptionWidget::updateEditActions(bool modified)
     ui->openAsTextButton->setEnabled(!modified);
 }
 
+void SolverOptionWidget::loadOptionFile(QTextCodec *codec)
+{
+    stopLoading();
+    mOptionTableModel->reloadSolverOptionModel(QList<SolverOptionItem *>());
+    ui->solverOptionTableView->clearSpans();
+
+    // the tokenizer reads the definition and installs the opt callbacks, this has to happen on the GUI thread
+    mLoader = new SolverOptionLoader(new OptionTokenizer(mOptDefFileName), mLocation, codec);
+    mLoader->moveToThread(&mLoadThread);
+    connect(&mLoadThread, &QThread::started, mLoader, &SolverOptionLoader::load);
+    connect(mLoader, &SolverOptionLoader::itemsAvailable, this, &SolverOptionWidget::appendLoadedOptions);
+    connect(mLoader, &SolverOptionLoader::finished, this, &SolverOptionWidget::optionFileLoaded);
+    mLoadThread.start();
+}
+
+void SolverOptionWidget::appendLoadedOptions()
+{
+    if (!mLoader)
+        return;
+    QList<SolverOptionItem *> items;
+    QList<OptionMessage> messages;
+    mLoader->takeLoaded(items, messages);
+    for (const OptionMessage &message : messages)
+        mOptionTokenizer->logger()->append(message.first, message.second);
+    if (items.isEmpty())
+        return;
+
+    int first = mOptionTableModel->rowCount();
+    mOptionTableModel->appendSolverOptionItems(items);
+    for (int i = 0; i < items.size(); ++i) {
+        if (!items.at(i)->disabled)
+            continue;
+        ui->solverOptionTableView->setSpan(first + i, 0, 1, mOptionTableModel->columnCount());
+        if (isViewCompact())
+            ui->solverOptionTableView->hideRow(first + i);
+    }
+    emit itemCountChanged(mOptionTableModel->rowCount());
+}
+
+void SolverOptionWidget::optionFileLoaded()
+{
+    // a finished signal of a canceled loader may still be queued
+    if (mLoader && mLoader->isFinished())
+        completeLoading();
+}
+
+void SolverOptionWidget::completeLoading()
+{
+    mLoadThread.quit();
+    mLoadThread.wait();
+    appendLoadedOptions();
+    delete mLoader;
+    mLoader = nullptr;
+    if (mOptionTableModel->rowCount() > 0) {
+        ui->solverOptionTableView->resizeColumnToContents(SolverOptionTableModel::COLUMN_OPTION_KEY);
+        ui->solverOptionTableView->resizeColumnToContents(SolverOptionTableModel::COLUMN_OPTION_VALUE);
+    }
+}
+
+void SolverOptionWidget::stopLoading()
+{
+    if (!mLoader)
+        return;
+    mLoadThread.requestInterruption();
+    mLoadThread.quit();
+    mLoadThread.wait();
+    delete mLoader;
+    mLoader = nullptr;
+}
+
 void SolverOptionWidget::updateTableColumnSpan()
 {
     ui->solverOptionTableView->clearSpans();
@@ -1473,7 +1547,7 @@ void SolverOptionWidget::on_newTableRowDropped(const QModelIndex &index)
     QModelIndexList definitionItems = ui->solverOptionTreeView->model()->match(ui->solverOptionTreeView->model()->index(0, OptionDefinitionModel::COLUMN_OPTION_NAME),
                                                                      Qt::DisplayRole,
                                                                      optionName, 1);
-    mOptionTokenizer->getOption()->setModified(optionName, true);
+    mOptionTokenizer->setModified(optionName, true);
     for(QModelIndex item : definitionItems) {
         ui->solverOptionTreeView->model()->setData(item, Qt::CheckState(Qt::Checked), Qt::CheckStateRole);
     }
@@ -1498,6 +1572,8 @@ void SolverOptionWidget::setModified(bool modified)
 
 bool SolverOptionWidget::saveAs(const QString &location)
 {
+    if (mLoader)
+        completeLoading();
     setModified(false);
     bool success = mOptionTokenizer->writeOptionFile(mOptionTableModel->getCurrentListOfOptionItems(), location, mCodec);
     if (mLocation != location) {
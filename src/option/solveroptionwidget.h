@@ -23,6 +23,7 @@
 #include <QMenu>
 #include <QWidget>
 #include <QStyledItemDelegate>
+#include <QThread>
 
 #include "common.h"
 #include "optioncompleterdelegate.h"
@@ -40,6 +41,7 @@ class SolverOptionWidget;
 }
 
 class OptionTokenizer;
+class SolverOptionLoader;
 
 class SolverOptionWidget : public QWidget
 {
@@ -116,6 +118,9 @@ private slots:
 
     void resizeColumnsToContents();
 
+    void appendLoadedOptions();
+    void optionFileLoaded();
+
 private:
     QList<int> getRecurrentOption(const QModelIndex &index);
     QString getOptionTableEntry(int row);
@@ -124,6 +129,7 @@ private:
     FileId mFileId;
     QString mLocation;
     QString mSolverName;
+    QString mOptDefFileName;
 
     bool mFileHasChangedExtern = false;
 
@@ -135,6 +141,9 @@ private:
     OptionTokenizer* mOptionTokenizer;
     OptionCompleterDelegate* mOptionCompleter;
 
+    QThread mLoadThread;
+    SolverOptionLoader* mLoader = nullptr;
+
     void refreshOptionTableModel(bool hideAllComments);
 
     void addActions();
@@ -146,6 +155,9 @@ private:
     bool isEverySelectionARow() const;
 
     bool init(const QString &optDefFileName);
+    void loadOptionFile(QTextCodec *codec);
+    void completeLoading();
+    void stopLoading();
 
     MainWindow* getMainWindow();
 
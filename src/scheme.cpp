@@ -8,6 +8,7 @@
 #include <QJsonArray>
 #include <QJsonDocument>
 #include <QGuiApplication>
+#include <QSvgRenderer>
 
 namespace gams {
 namespace studio {
@@ -27,6 +28,7 @@ Scheme::~Scheme()
     for (SvgEngine *eng: mEngines)
         eng->unbind();
     mEngines.clear();
+    qDeleteAll(mRendererCache);
 }
 
 Scheme *Scheme::instance()
@@ -345,6 +347,9 @@ void Scheme::invalidate()
     mIconCodes = iconCodes();
     mIconCache.clear();
     mDataCache.clear();
+    qDeleteAll(mRendererCache);
+    mRendererCache.clear();
+    ++mGeneration;
 
     emit changed();
 }
@@ -396,10 +401,15 @@ QIcon Scheme::icon(QString name, bool forceSquare, QString disabledName)
     return icon(name, StudioScope, forceSquare, disabledName);
 }
 
+QString Scheme::dataKey(const QString &name, Scope scope, QIcon::Mode mode)
+{
+    static const QStringList ext {"_N","_D","_A","_S"};
+    return QString("%1@%2").arg(scope).arg(name + ext.at(int(mode)));
+}
+
 QByteArray &Scheme::data(QString name, Scope scope, QIcon::Mode mode)
 {
-    QStringList ext {"_N","_D","_A","_S"};
-    QString nameKey = QString("%1@%2").arg(scope).arg(name + ext.at(int(mode)));
+    QString nameKey = dataKey(name, scope, mode);
     if (!instance()->mDataCache.contains(nameKey)) {
         QByteArray data(instance()->colorizedContent(name, scope, mode));
         instance()->mDataCache.insert(nameKey, data);
@@ -407,6 +417,17 @@ QByteArray &Scheme::data(QString name, Scope scope, QIcon::Mode mode)
     return instance()->mDataCache[nameKey];
 }
 
+QSvgRenderer *Scheme::renderer(QString name, Scope scope, QIcon::Mode mode)
+{
+    QString nameKey = dataKey(name, scope, mode);
+    QSvgRenderer *res = instance()->mRendererCache.value(nameKey);
+    if (!res) {
+        res = new QSvgRenderer(data(name, scope, mode));
+        instance()->mRendererCache.insert(nameKey, res);
+    }
+    return res;
+}
+
 bool Scheme::hasFlag(Scheme::ColorSlot slot, Scheme::FontFlag flag, Scope scope)
 {
     int scheme = instance()->mScopeScheme.value(scope);
@@ -7,6 +7,8 @@
 #include <QIcon>
 #include <QPalette>
 
+class QSvgRenderer;
+
 namespace gams {
 namespace studio {
 
@@ -101,6 +103,7 @@ public:
     int activeScheme(Scope scope) const;
     ColorSlot slot(QString name);
     void invalidate();
+    int generation() const { return mGeneration; }
     void unbind(SvgEngine *engine);
     bool isValidScope(int scopeValue);
 
@@ -116,6 +119,7 @@ public:
     static QIcon icon(QString name, Scope scope, bool forceSquare = false, QString disabledName = QString());
     static QIcon icon(QString name, bool forceSquare = false, QString disabledName = QString());
     static QByteArray &data(QString name, Scope scope, QIcon::Mode mode);
+    static QSvgRenderer *renderer(QString name, Scope scope, QIcon::Mode mode);
     static bool hasFlag(ColorSlot slot, FontFlag flag, Scheme::Scope scope = Scheme::EditorScope);
     static void setFlags(ColorSlot slot, FontFlag flag, Scheme::Scope scope = Scheme::EditorScope);
 
@@ -128,6 +132,7 @@ private:
     void initSlotTexts();
     QList<QHash<QString, QStringList>> iconCodes() const;
     QByteArray colorizedContent(QString name, Scope scope, QIcon::Mode mode = QIcon::Normal);
+    static QString dataKey(const QString &name, Scope scope, QIcon::Mode mode);
 
 private:
     static Scheme *mInstance;
@@ -140,6 +145,8 @@ private:
     QList<QHash<QString, QStringList>> mIconCodes;
     QHash<QString, QIcon> mIconCache;
     QHash<QString, QByteArray> mDataCache;
+    QHash<QString, QSvgRenderer*> mRendererCache;
+    int mGeneration = 0;
     QVector<SvgEngine*> mEngines;
 };
 
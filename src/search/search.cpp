@@ -21,9 +21,11 @@
 #include "searchdialog.h"
 #include "searchworker.h"
 #include "exception.h"
+#include "settings.h"
 
 #include <QApplication>
 #include <QFlags>
+#include <QTextCodec>
 #include <QTextDocument>
 #include <QMessageBox>
 #include <QPushButton>
@@ -38,9 +40,11 @@ Search::Search(MainWindow *main) : mMain(main)
 
 }
 
-void Search::setParameters(QList<FileMeta*> files, QRegularExpression regex, bool searchBackwards)
+void Search::setParameters(QList<FileMeta*> files, QRegularExpression regex, bool searchBackwards,
+                           QStringList diskFiles)
 {
     mFiles = files;
+    mDiskFiles = diskFiles;
     mRegex = regex;
     mOptions = QFlags<QTextDocument::FindFlag>();
 
@@ -57,7 +61,7 @@ void Search::start()
     mResultHash.clear();
 
     mSearching = true;
-    QList<FileMeta*> unmodified;
+    QList<SearchFile> unmodified;
     QList<FileMeta*> modified; // need to be treated differently
 
     for(FileMeta* fm : mFiles) {
@@ -67,7 +71,12 @@ void Search::start()
 
         // sort files by modified
         if (fm->isModified()) modified << fm;
-        else unmodified << fm;
+        else unmodified << SearchFile {fm->location(), fm->codec()};
+    }
+    if (!mDiskFiles.isEmpty()) {
+        QTextCodec *codec = QTextCodec::codecForMib(Settings::settings()->toInt(skDefaultCodecMib));
+        for (const QString &location : mDiskFiles)
+            unmodified << SearchFile {location, codec};
     }
 
     // non-parallel first
@@ -95,6 +104,7 @@ void Search::stop()
 void Search::reset()
 {
     mFiles.clear();
+    mDiskFiles.clear();
 
     mOptions = QFlags<QTextDocument::FindFlag>();
     mCacheAvailable = false;
@@ -37,7 +37,8 @@ public:
         ThisFile = 0,
         ThisGroup= 1,
         OpenTabs = 2,
-        AllFiles = 3
+        AllFiles = 3,
+        IncludedFiles = 4
     };
 
     enum Status {
@@ -53,7 +54,8 @@ public:
     };
     Search(MainWindow* main);
 
-    void setParameters(QList<FileMeta*> files, QRegularExpression regex, bool searchBackwards = false);
+    void setParameters(QList<FileMeta*> files, QRegularExpression regex, bool searchBackwards = false,
+                       QStringList diskFiles = QStringList());
     void start();
     void stop();
     void reset();
@@ -90,6 +92,7 @@ private:
     QList<Result> mResults;
     QHash<QString, QList<Result>> mResultHash;
     QList<FileMeta*> mFiles;
+    QStringList mDiskFiles;     // files without FileMeta, only searched on disk
     QRegularExpression mRegex;
     QFlags<QTextDocument::FindFlag> mOptions;
 
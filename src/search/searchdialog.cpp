@@ -65,7 +65,7 @@ void SearchDialog::on_btn_Replace_clicked()
     insertHistory();
 
     mShowResults = false;
-    mSearch.setParameters(getFilesByScope(), createRegex());
+    mSearch.setParameters(getFilesByScope(), createRegex(), false, getDiskFilesByScope());
     mSearch.start();
     mSearch.replaceNext(ui->txt_replace->text());
 }
@@ -87,7 +87,7 @@ void SearchDialog::on_btn_FindAll_clicked()
         if (ui->combo_search->currentText().isEmpty()) return;
 
         updateUi(true);
-        mSearch.setParameters(getFilesByScope(), createRegex());
+        mSearch.setParameters(getFilesByScope(), createRegex(), false, getDiskFilesByScope());
         insertHistory();
 
         clearResultsView();
@@ -176,16 +176,26 @@ QList<FileMeta*> SearchDialog::getFilesByScope(bool ignoreReadOnly)
     case Search::AllFiles:
         files = mMain->fileRepo()->fileMetas();
         break;
+    case Search::IncludedFiles:
+    {
+        // the current file and all files it includes, taken from the include graph of its run group
+        FileMeta* fm = mMain->fileRepo()->fileMeta(mMain->recent()->editor());
+        ProjectFileNode* p = mMain->projectRepo()->findFileNode(mMain->recent()->editor());
+        if (!fm || !p || !p->assignedRunGroup()) return files;
+        files << fm;
+        // lookup only, included files without FileMeta are taken by getDiskFilesByScope
+        for (const QString &location: p->assignedRunGroup()->includeGraph()->includedFiles(fm->location())) {
+            FileMeta *inc = mMain->fileRepo()->fileMeta(location);
+            if (inc && !files.contains(inc)) files << inc;
+        }
+    }
+        break;
     default:
         break;
     }
 
     // apply filter
-    QStringList filter = ui->combo_filePattern->currentText().split(',', QString::SkipEmptyParts);
-    // convert user input to wildcard list
-    QList<QRegExp> filterList;
-    for (QString s : filter)
-        filterList.append(QRegExp(s.trimmed(), Qt::CaseInsensitive, QRegExp::Wildcard));
+    QList<QRegExp> filterList = fileFilters();
 
     // filter files
     FileMeta* current = mMain->fileRepo()->fileMeta(mMain->recent()->editor());
@@ -206,6 +216,37 @@ QList<FileMeta*> SearchDialog::getFilesByScope(bool ignoreReadOnly)
     return res;
 }
 
+QStringList SearchDialog::getDiskFilesByScope()
+{
+    // included files without FileMeta are searched on disk only, they aren't opened or replaced
+    QStringList res;
+    if (ui->combo_scope->currentIndex() != Search::IncludedFiles) return res;
+    FileMeta* fm = mMain->fileRepo()->fileMeta(mMain->recent()->editor());
+    ProjectFileNode* p = mMain->projectRepo()->findFileNode(mMain->recent()->editor());
+    if (!fm || !p || !p->assignedRunGroup()) return res;
+    QList<QRegExp> filterList = fileFilters();
+    for (const QString &location: p->assignedRunGroup()->includeGraph()->includedFiles(fm->location())) {
+        if (mMain->fileRepo()->fileMeta(location)) continue;
+        for (QRegExp wildcard : filterList) {
+            if (wildcard.indexIn(location) != -1) {
+                res << location;
+                break;
+            }
+        }
+    }
+    return res;
+}
+
+QList<QRegExp> SearchDialog::fileFilters() const
+{
+    QStringList filter = ui->combo_filePattern->currentText().split(',', QString::SkipEmptyParts);
+    // convert user input to wildcard list
+    QList<QRegExp> filterList;
+    for (QString s : filter)
+        filterList.append(QRegExp(s.trimmed(), Qt::CaseInsensitive, QRegExp::Wildcard));
+    return filterList;
+}
+
 void SearchDialog::showEvent(QShowEvent *event)
 {
     Q_UNUSED(event)
@@ -271,7 +312,7 @@ void SearchDialog::on_btn_back_clicked()
     }
 
     mShowResults = false;
-    mSearch.setParameters(getFilesByScope(), createRegex(), true);
+    mSearch.setParameters(getFilesByScope(), createRegex(), true, getDiskFilesByScope());
 
     insertHistory();
     mSearch.findNext(Search::Backward);
@@ -286,7 +327,7 @@ void SearchDialog::on_btn_forward_clicked()
     }
 
     mShowResults = false;
-    mSearch.setParameters(getFilesByScope(), createRegex());
+    mSearch.setParameters(getFilesByScope(), createRegex(), false, getDiskFilesByScope());
 
     insertHistory();
     mSearch.findNext(Search::Forward);
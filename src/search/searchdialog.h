@@ -90,6 +90,8 @@ protected:
 private:
     QString searchTerm();
     QList<FileMeta*> getFilesByScope(bool ignoreReadOnly = false);
+    QStringList getDiskFilesByScope();
+    QList<QRegExp> fileFilters() const;
     int updateLabelByCursorPos(int lineNr = -1, int colNr = -1);
     void insertHistory();
     void searchParameterChanged();
@@ -22,15 +22,17 @@
 
 #include <QFile>
 #include <QRegularExpression>
+#include <QTextStream>
+#include <QThread>
 
-#include "file/filemeta.h"
+#include "common.h"
 
 namespace gams {
 namespace studio {
 namespace search {
 
-SearchWorker::SearchWorker(QList<FileMeta*> fml, QRegularExpression regex, QList<Result> *list)
-    : mFiles(fml), mMatches(list), mRegex(regex)
+SearchWorker::SearchWorker(QList<SearchFile> files, QRegularExpression regex, QList<Result> *list)
+    : mFiles(files), mMatches(list), mRegex(regex)
 {
 }
 
@@ -42,14 +44,14 @@ void SearchWorker::findInFiles()
 {
     QList<Result> res;
     bool cacheFull = false;
-    for (FileMeta* fm : mFiles) {
+    for (const SearchFile &sf : mFiles) {
         if (cacheFull) break;
 
         int lineCounter = 0;
-        QFile file(fm->location());
+        QFile file(sf.location);
         if (file.open(QIODevice::ReadOnly)) {
             QTextStream in(&file);
-            in.setCodec(fm->codec());
+            in.setCodec(sf.codec);
 
             while (!in.atEnd() && !cacheFull) { // read file
 
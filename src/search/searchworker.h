@@ -26,19 +26,24 @@
 #include <QObject>
 #include <QRegularExpression>
 
+class QTextCodec;
+
 namespace gams {
 namespace studio {
-
-class FileMeta;
-
 namespace search {
 
+struct SearchFile
+{
+    QString location;
+    QTextCodec *codec;
+};
+
 class SearchResultModel;
 class SearchWorker : public QObject
 {
     Q_OBJECT
 public:
-    SearchWorker(QList<FileMeta*> fml, QRegularExpression regex, QList<Result> *list);
+    SearchWorker(QList<SearchFile> files, QRegularExpression regex, QList<Result> *list);
     ~SearchWorker();
     void findInFiles();
 
@@ -47,7 +52,7 @@ signals:
     void resultReady();
 
 private:
-    QList<FileMeta*> mFiles;
+    QList<SearchFile> mFiles;
     QList<Result>* mMatches;
     QRegularExpression mRegex;
 };
@@ -22,12 +22,14 @@
 #include <QJsonDocument>
 #include <QDir>
 #include <QSettings>
+#include <QSet>
 #include <QFile>
 #include <QSize>
 #include <QPoint>
 #include <QFontDatabase>
 #include "logger.h"
 #include "settings.h"
+#include "settingssnapshot.h"
 #include "commonpaths.h"
 #include "version.h"
 #include "exception.h"
@@ -175,6 +177,7 @@ Settings::Settings(bool ignore, bool reset, bool resetView)
         if (settings) {
             // only if the basic settings file has been created ...
             mSettings.insert(scSys, settings);
+            mSnapshot = new SettingsSnapshot(settingsPath() + "/studio.snapshot");
             loadFile(scSys);
             settings = newQSettings("usersettings");
             mSettings.insert(scUser, settings);
@@ -198,6 +201,8 @@ Settings::Settings(bool ignore, bool reset, bool resetView)
 
 Settings::~Settings()
 {
+    delete mSnapshot; // writes pending changes
+    mSnapshot = nullptr;
     QMap<Scope, QSettings*>::iterator si = mSettings.begin();
     while (si != mSettings.end()) {
         QSettings *set = si.value();
@@ -392,6 +397,14 @@ QList<SettingsKey> Settings::viewKeys()
     };
 }
 
+QList<SettingsKey> Settings::snapshotKeys()
+{
+    // big and frequently changed parts, stored in a binary snapshot instead of the JSON file
+    return QList<SettingsKey> {
+        skProjects, skTabs, skHistory
+    };
+}
+
 void Settings::resetKeys(QList<SettingsKey> keys)
 {
     for (const SettingsKey &key : keys) {
@@ -603,12 +616,26 @@ void Settings::saveFile(Scope scope)
     }
     QSettings *settings = mSettings.value(scopes.base);
 
+    // the snapshot keys of this scope
+    QSet<QString> snapNames;
+    if (mSnapshot) {
+        for (const SettingsKey &key : snapshotKeys()) {
+            KeyData dat = mKeys.value(key);
+            if (dat.scope == scopes.base) snapNames << dat.keys.first();
+        }
+    }
+
     // store base settings
     QVariantMap baseDat;
+    QVariantMap snapDat;
     Data src = mData.value(scopes.base);
     for (Data::const_iterator it = src.constBegin() ; it != src.constEnd() ; ++it) {
-        baseDat.insert(it.key(), it.value());
+        if (snapNames.contains(it.key()))
+            snapDat.insert(it.key(), it.value());
+        else
+            baseDat.insert(it.key(), it.value());
     }
+    if (!snapDat.isEmpty()) mSnapshot->store(snapDat);
     addVersionInfo(scope, baseDat);
     settings->setValue("base", baseDat);
 
@@ -741,6 +768,7 @@ void Settings::loadFile(Scope scope)
         loadMap(scopes.base, dat);
         loadVersionData(scopes);
     }
+    if (scopes.base == scSys) loadSnapshot();
 
 //    Scheme::instance()->initDefault();
 
@@ -750,6 +778,18 @@ void Settings::loadFile(Scope scope)
     setString(skUserModelLibraryDir, CommonPaths::userModelLibraryDir());
 }
 
+void Settings::loadSnapshot()
+{
+    // older settings files still contain these keys, then they have been read from the JSON file
+    QVariantMap dat;
+    if (!mSnapshot || !mSnapshot->load(dat)) return;
+    for (const SettingsKey &key : snapshotKeys()) {
+        KeyData keyDat = mKeys.value(key);
+        if (keyDat.scope != scSys || !dat.contains(keyDat.keys.first())) continue;
+        setDirectValue(scSys, keyDat.keys.first(), dat.value(keyDat.keys.first()));
+    }
+}
+
 void Settings::importSettings(const QString &path)
 {
     if (!mSettings.value(scUser)) return;
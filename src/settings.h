@@ -128,6 +128,8 @@ enum SettingsKey {
     skSettingsKeyCount,
 };
 
+class SettingsSnapshot;
+
 class Settings
 {
 public:
@@ -151,6 +153,7 @@ public:
     static int version(Scope scope);
     static void useRelocatedPathForTests();
     static QList<SettingsKey> viewKeys();
+    static QList<SettingsKey> snapshotKeys();
 
     void loadFile(Scope scopeFilter);
     void save();
@@ -207,6 +210,7 @@ private:
     const QHash<SettingsKey, KeyData> mKeys;
     QMap<Scope, QSettings*> mSettings;
     QMap<Scope, Data> mData;
+    SettingsSnapshot *mSnapshot = nullptr;
 
 private:
     Settings(bool ignore, bool reset, bool resetView);
@@ -223,6 +227,7 @@ private:
     void initDefault();
     void addVersionInfo(Scope scope, QVariantMap &map);
     void saveFile(Scope scope);
+    void loadSnapshot();
     void loadMap(Scope scope, QVariantMap map);
     QVariant read(SettingsKey key);
 
@@ -0,0 +1,129 @@
+/*
+ * This file is part of the GAMS Studio project.
+ *
+ * Copyright (c) 2017-2020 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2020 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "settingssnapshot.h"
+#include "logger.h"
+#include <QtConcurrent>
+#include <QJsonValue>
+#include <QDataStream>
+#include <QSaveFile>
+#include <QFile>
+
+namespace gams {
+namespace studio {
+
+SettingsSnapshot::SettingsSnapshot(const QString &fileName, QObject *parent)
+    : QObject(parent), mFileName(fileName)
+{
+    mWriteTimer.setSingleShot(true);
+    mWriteTimer.setInterval(CWriteDelay);
+    connect(&mWriteTimer, &QTimer::timeout, this, &SettingsSnapshot::writePending);
+    connect(&mWriter, &QFutureWatcher<bool>::finished, this, &SettingsSnapshot::writeFinished);
+}
+
+SettingsSnapshot::~SettingsSnapshot()
+{
+    flush();
+}
+
+bool SettingsSnapshot::load(QVariantMap &data)
+{
+    flush();
+    QFile file(mFileName);
+    if (!file.open(QFile::ReadOnly)) return false;
+    QDataStream in(&file);
+    in.setVersion(QDataStream::Qt_5_9);
+    quint32 magic;
+    quint16 version;
+    in >> magic >> version;
+    if (magic != CSnapshotMagic || version != CSnapshotVersion) {
+        DEB() << "Ignoring settings snapshot of unknown format: " << mFileName;
+        return false;
+    }
+    QVariantMap res;
+    in >> res;
+    if (in.status() != QDataStream::Ok) {
+        DEB() << "Ignoring corrupted settings snapshot: " << mFileName;
+        return false;
+    }
+    data = res;
+    mData = res;
+    return true;
+}
+
+void SettingsSnapshot::store(const QVariantMap &data)
+{
+    if (data == mData) return;
+    mData = data;
+    mPending = true;
+    // not restarted on further updates, so a steady stream of changes is still written regularly
+    if (!mWriteTimer.isActive()) mWriteTimer.start();
+}
+
+void SettingsSnapshot::flush()
+{
+    mWriteTimer.stop();
+    mWriter.waitForFinished();
+    if (!mPending) return;
+    mPending = false;
+    if (!write(mFileName, mData))
+        DEB() << "Error writing settings snapshot: " << mFileName;
+}
+
+QString SettingsSnapshot::fileName() const
+{
+    return mFileName;
+}
+
+void SettingsSnapshot::writePending()
+{
+    if (!mPending) return;
+    if (mWriter.isRunning()) return; // writeFinished() takes care of the remaining changes
+    mPending = false;
+    mWriter.setFuture(QtConcurrent::run(&SettingsSnapshot::write, mFileName, mData));
+}
+
+void SettingsSnapshot::writeFinished()
+{
+    if (!mWriter.result())
+        DEB() << "Error writing settings snapshot: " << mFileName;
+    if (mPending && !mWriteTimer.isActive()) mWriteTimer.start();
+}
+
+bool SettingsSnapshot::write(const QString &fileName, const QVariantMap &data)
+{
+    // JSON types (of default values) can't be streamed in all Qt versions, convert them to plain variants
+    QVariantMap plain;
+    for (QVariantMap::const_iterator it = data.constBegin(); it != data.constEnd(); ++it)
+        plain.insert(it.key(), QJsonValue::fromVariant(it.value()).toVariant());
+
+    QSaveFile file(fileName);
+    if (!file.open(QFile::WriteOnly)) return false;
+    QDataStream out(&file);
+    out.setVersion(QDataStream::Qt_5_9);
+    out << CSnapshotMagic << CSnapshotVersion << plain;
+    if (out.status() != QDataStream::Ok) {
+        file.cancelWriting();
+        return false;
+    }
+    return file.commit();
+}
+
+} // namespace studio
+} // namespace gams
@@ -0,0 +1,69 @@
+/*
+ * This file is part of the GAMS Studio project.
+ *
+ * Copyright (c) 2017-2020 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2020 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef SETTINGSSNAPSHOT_H
+#define SETTINGSSNAPSHOT_H
+
+#include <QObject>
+#include <QVariantMap>
+#include <QFutureWatcher>
+#include <QTimer>
+
+namespace gams {
+namespace studio {
+
+///
+/// \brief The SettingsSnapshot stores large and frequently rewritten settings (like projects and tabs) in a
+/// binary file.
+/// \details Rapid updates are coalesced, the file is written on a worker thread and replaced atomically.
+///
+class SettingsSnapshot : public QObject
+{
+    Q_OBJECT
+public:
+    SettingsSnapshot(const QString &fileName, QObject *parent = nullptr);
+    ~SettingsSnapshot() override;
+    bool load(QVariantMap &data);
+    void store(const QVariantMap &data);
+    void flush();
+    QString fileName() const;
+
+private slots:
+    void writePending();
+    void writeFinished();
+
+private:
+    static bool write(const QString &fileName, const QVariantMap &data);
+
+private:
+    static const quint32 CSnapshotMagic = 0x47535353; // "GSSS"
+    static const quint16 CSnapshotVersion = 1;
+    static const int CWriteDelay = 500; // ms to collect updates before writing
+
+    QString mFileName;
+    QVariantMap mData;
+    bool mPending = false;
+    QTimer mWriteTimer;
+    QFutureWatcher<bool> mWriter;
+};
+
+} // namespace studio
+} // namespace gams
+
+#endif // SETTINGSSNAPSHOT_H
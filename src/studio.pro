@@ -81,6 +81,7 @@ SOURCES += \
     commandlineparser.cpp \
     commonpaths.cpp \
     confirmdialog.cpp \
+    diagnostics.cpp \
     editors/abstractedit.cpp \
     editors/abstracttextmapper.cpp \
     editors/codeedit.cpp \
@@ -117,7 +118,9 @@ SOURCES += \
     engine/enginestartdialog.cpp \
     exception.cpp \
     file/dynamicfile.cpp \
+    file/filechangewatcher.cpp \
     file/fileevent.cpp \
+    file/includegraph.cpp \
     file/fileicon.cpp \
     file/filemeta.cpp \
     file/filemetarepo.cpp \
@@ -139,13 +142,17 @@ SOURCES += \
     gdxviewer/columnfilter.cpp \
     gdxviewer/columnfilterframe.cpp \
     gdxviewer/filteruelmodel.cpp \
+    gdxviewer/gdxdatastore.cpp \
     gdxviewer/gdxsymbol.cpp \
     gdxviewer/gdxsymbolheaderview.cpp \
     gdxviewer/gdxsymboltable.cpp \
     gdxviewer/gdxsymbolview.cpp \
     gdxviewer/gdxviewer.cpp \
     gdxviewer/nestedheaderview.cpp \
+    gdxviewer/selectionexport.cpp \
+    gdxviewer/symbolstatistics.cpp \
     gdxviewer/tableviewmodel.cpp \
+    gdxviewer/uelindex.cpp \
     gdxviewer/valuefilter.cpp \
     gdxviewer/valuefilterwidget.cpp \
     gotodialog.cpp \
@@ -153,7 +160,6 @@ SOURCES += \
     logger.cpp \
     logtabcontextmenu.cpp \
     lxiviewer/lxiparser.cpp \
-    lxiviewer/lxitreeitem.cpp \
     lxiviewer/lxitreemodel.cpp \
     lxiviewer/lxiviewer.cpp \
     main.cpp \
@@ -167,6 +173,8 @@ SOURCES += \
     miro/miroprocess.cpp \
     modeldialog/glbparser.cpp   \
     modeldialog/library.cpp     \
+    modeldialog/librarycache.cpp \
+    modeldialog/libraryfiltermodel.cpp \
     modeldialog/libraryitem.cpp \
     modeldialog/librarymodel.cpp \
     modeldialog/modeldialog.cpp \
@@ -201,6 +209,7 @@ SOURCES += \
     option/paramconfigeditor.cpp \
     option/parametereditor.cpp \
     option/solveroptiondefinitionmodel.cpp \
+    option/solveroptionloader.cpp \
     option/solveroptiontablemodel.cpp \
     option/solveroptionwidget.cpp \
     process/abstractprocess.cpp \
@@ -229,6 +238,7 @@ SOURCES += \
     search/searchresultmodel.cpp \
     search/searchworker.cpp \
     settings.cpp \
+    settingssnapshot.cpp \
     settingsdialog.cpp \
     statuswidgets.cpp \
     support/checkforupdatewrapper.cpp \
@@ -241,6 +251,7 @@ SOURCES += \
     svgengine.cpp \
     syntax/basehighlighter.cpp \
     syntax/blockdata.cpp \
+    syntax/symbolindex.cpp \
     syntax/syntaxdeclaration.cpp \
     syntax/syntaxformats.cpp \
     syntax/syntaxhighlighter.cpp \
@@ -261,6 +272,7 @@ HEADERS += \
     common.h \
     commonpaths.h \
     confirmdialog.h \
+    diagnostics.h \
     editors/abstractedit.h \
     editors/abstractsystemlogger.h \
     editors/abstracttextmapper.h \
@@ -301,7 +313,9 @@ HEADERS += \
     exception.h \
     file.h \
     file/dynamicfile.h \
+    file/filechangewatcher.h \
     file/fileevent.h \
+    file/includegraph.h \
     file/fileicon.h \
     file/filemeta.h \
     file/filemetarepo.h \
@@ -323,13 +337,17 @@ HEADERS += \
     gdxviewer/columnfilter.h \
     gdxviewer/columnfilterframe.h \
     gdxviewer/filteruelmodel.h \
+    gdxviewer/gdxdatastore.h \
     gdxviewer/gdxsymbol.h \
     gdxviewer/gdxsymbolheaderview.h \
     gdxviewer/gdxsymboltable.h \
     gdxviewer/gdxsymbolview.h \
     gdxviewer/gdxviewer.h \
     gdxviewer/nestedheaderview.h \
+    gdxviewer/selectionexport.h \
+    gdxviewer/symbolstatistics.h \
     gdxviewer/tableviewmodel.h \
+    gdxviewer/uelindex.h \
     gdxviewer/valuefilter.h \
     gdxviewer/valuefilterwidget.h \
     gotodialog.h \
@@ -337,7 +355,6 @@ HEADERS += \
     logger.h \
     logtabcontextmenu.h \
     lxiviewer/lxiparser.h \
-    lxiviewer/lxitreeitem.h \
     lxiviewer/lxitreemodel.h \
     lxiviewer/lxiviewer.h \
     maintabcontextmenu.h \
@@ -350,6 +367,8 @@ HEADERS += \
     miro/miroprocess.h \
     modeldialog/glbparser.h \
     modeldialog/library.h \
+    modeldialog/librarycache.h \
+    modeldialog/libraryfiltermodel.h \
     modeldialog/libraryitem.h \
     modeldialog/librarymodel.h \
     modeldialog/modeldialog.h \
@@ -384,6 +403,7 @@ HEADERS += \
     option/paramconfigeditor.h \
     option/parametereditor.h \
     option/solveroptiondefinitionmodel.h \
+    option/solveroptionloader.h \
     option/solveroptiontablemodel.h \
     option/solveroptionwidget.h \
     process.h \
@@ -413,6 +433,7 @@ HEADERS += \
     search/searchresultmodel.h \
     search/searchworker.h \
     settings.h \
+    settingssnapshot.h \
     settingsdialog.h \
     statuswidgets.h \
     support/checkforupdatewrapper.h \
@@ -427,6 +448,7 @@ HEADERS += \
     syntax/basehighlighter.h \
     syntax/blockcode.h \
     syntax/blockdata.h \
+    syntax/symbolindex.h \
     syntax/syntaxdeclaration.h \
     syntax/syntaxformats.h \
     syntax/syntaxhighlighter.h \
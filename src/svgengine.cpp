@@ -29,6 +29,8 @@ SvgEngine::SvgEngine(const SvgEngine &other) : QIconEngine()
     mName = other.mName;
     mNameD = other.mNameD;
     mNormalMode = other.mNormalMode;
+    mPixmapCache = other.mPixmapCache;
+    mCacheGeneration = other.mCacheGeneration;
 }
 
 SvgEngine::~SvgEngine()
@@ -52,11 +54,13 @@ QString SvgEngine::iconName() const
 void SvgEngine::replaceNormalMode(QIcon::Mode mode)
 {
     mNormalMode = mode;
+    mPixmapCache.clear();
 }
 
 void SvgEngine::forceSquare(bool force)
 {
     mForceSquare = force;
+    mPixmapCache.clear();
 }
 
 void SvgEngine::unbind()
@@ -70,11 +74,10 @@ void SvgEngine::paint(QPainter *painter, const QRect &rect, QIcon::Mode mode, QI
     Q_UNUSED(state)
     if (mode == QIcon::Normal) mode = mNormalMode;
     const QString &name = (mode == QIcon::Disabled ? mNameD : mName);
-    QByteArray &data = mController->data(name, Scheme::Scope(mScope), mode);
-    QSvgRenderer renderer(data);
+    QSvgRenderer *renderer = mController->renderer(name, Scheme::Scope(mScope), mode);
     QRect pRect = rect;
     if (mForceSquare) pRect.setWidth(pRect.height());
-    renderer.render(painter, pRect);
+    renderer->render(painter, pRect);
 }
 
 QIconEngine *SvgEngine::clone() const
@@ -84,6 +87,16 @@ QIconEngine *SvgEngine::clone() const
 
 QPixmap SvgEngine::pixmap(const QSize &size, QIcon::Mode mode, QIcon::State state)
 {
+    // QIcon requests the size in device pixels, so the size also covers the device pixel ratio
+    if (mController && mCacheGeneration != mController->generation()) {
+        mPixmapCache.clear();
+        mCacheGeneration = mController->generation();
+    }
+    if (mode == QIcon::Normal) mode = mNormalMode;
+    QString key = QString("%1:%2:%3x%4").arg(mode).arg(state).arg(size.width()).arg(size.height());
+    QPixmap cached = mPixmapCache.value(key);
+    if (!cached.isNull()) return cached;
+
     QImage img(size, QImage::Format_ARGB32_Premultiplied);
     img.fill(Qt::transparent);
     QPainter painter(&img);
@@ -95,6 +108,7 @@ QPixmap SvgEngine::pixmap(const QSize &size, QIcon::Mode mode, QIcon::State stat
 //        opt.palette = QGuiApplication::palette();
 //        return QApplication::style()->generatedIconPixmap(mode, res, &opt);
 //    }
+    mPixmapCache.insert(key, res);
     return  res;
 }
 
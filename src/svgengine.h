@@ -4,6 +4,8 @@
 #include <QIconEngine>
 #include <QSvgRenderer>
 #include <QIconEnginePlugin>
+#include <QPixmap>
+#include <QHash>
 
 namespace gams {
 namespace studio {
@@ -32,6 +34,8 @@ private:
     QString mName;
     QString mNameD;
     QIcon::Mode mNormalMode = QIcon::Normal;
+    QHash<QString, QPixmap> mPixmapCache;
+    int mCacheGeneration = -1;
 
 };
 
@@ -17,6 +17,7 @@
  */
 #include "basehighlighter.h"
 #include "logger.h"
+#include "diagnostics.h"
 #include <QTimer>
 
 namespace gams {
@@ -105,6 +106,7 @@ void BaseHighlighter::rehighlight()
 
 void BaseHighlighter::rehighlightBlock(const QTextBlock &block)
 {
+    DIAGNOSE("highlighter")
     if (!mDoc || !block.isValid()) return;
     mCurrentBlock = block;
     bool forceHighlightOfNextBlock = true;
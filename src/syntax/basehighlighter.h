@@ -42,6 +42,7 @@ public:
     QTextDocument *document() const;
     void pause();
     void resume();
+    bool hasDirtyBlocks() const { return !mDirtyBlocks.isEmpty(); }
 
 signals:
     void needUnfold(QTextBlock block);
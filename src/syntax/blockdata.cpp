@@ -23,7 +23,7 @@ QChar BlockData::charForPos(int relPos)
     return QChar();
 }
 
-QVector<ParenthesesPos> BlockData::parentheses() const
+const QVector<ParenthesesPos> &BlockData::parentheses() const
 {
     return mParentheses;
 }
@@ -36,7 +36,7 @@ public:
     static BlockData *fromTextBlock(QTextBlock block);
     QChar charForPos(int relPos);
     bool isEmpty() {return mParentheses.isEmpty();}
-    QVector<ParenthesesPos> parentheses() const;
+    const QVector<ParenthesesPos> &parentheses() const;
     void setParentheses(const QVector<ParenthesesPos> &parentheses, const NestingImpact &nestingImpact);
     NestingImpact nestingImpact() const { return mNestingImpact; }
     int &foldCount() { return mFoldCount; }
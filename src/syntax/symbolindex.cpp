@@ -0,0 +1,325 @@
+/*
+ * This file is part of the GAMS Studio project.
+ *
+ * Copyright (c) 2017-2020 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2020 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "symbolindex.h"
+#include "syntaxhighlighter.h"
+#include "logger.h"
+#include <QTextDocument>
+#include <QTextCursor>
+#include <QTextStream>
+#include <QFile>
+#include <QFileInfo>
+#include <QtConcurrent>
+
+namespace gams {
+namespace studio {
+namespace syntax {
+
+///
+/// \brief Runs the SyntaxHighlighter on a hidden document and records the symbols into a SymbolIndex.
+///
+class SymbolScanner : public SyntaxHighlighter
+{
+public:
+    SymbolScanner(QTextDocument *doc, SymbolIndex *index) : SyntaxHighlighter(doc), mIndex(index) {}
+    void reset() { mType = SymbolIndex::stUnknown; }
+
+protected:
+    void syntaxBlockFound(const QString &text, const SyntaxBlock &block) override;
+
+private:
+    static SymbolIndex::SymbolType declarationType(const QString &keyword);
+    static bool isIdentStart(QChar c) { return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || c == '_'; }
+    static bool isIdentChar(QChar c) { return isIdentStart(c) || (c >= '0' && c <= '9'); }
+
+    SymbolIndex *mIndex;
+    SymbolIndex::SymbolType mType = SymbolIndex::stUnknown;
+};
+
+void SymbolScanner::syntaxBlockFound(const QString &text, const SyntaxBlock &block)
+{
+    if (!block.syntax || block.start >= block.end) return;
+    int line = currentBlock().blockNumber();
+    switch (block.syntax->kind()) {
+    case SyntaxKind::Declaration:
+        mType = declarationType(text.mid(block.start, block.end - block.start).trimmed());
+        return;
+    case SyntaxKind::Standard:
+    case SyntaxKind::Formula:
+    case SyntaxKind::Assignment:
+    case SyntaxKind::SolveBody:
+    case SyntaxKind::OptionBody:
+    case SyntaxKind::ExecuteBody:
+    case SyntaxKind::Identifier:
+    case SyntaxKind::IdentifierDim:
+    case SyntaxKind::IdentifierDimEnd:
+        break;
+    default:
+        return;
+    }
+
+    // record each identifier of the block as usage, the first one of an Identifier block is declared
+    bool declare = block.syntax->kind() == SyntaxKind::Identifier;
+    int i = block.start;
+    while (i < block.end) {
+        if (!isIdentStart(text.at(i)) || (i > 0 && (isIdentChar(text.at(i-1)) || text.at(i-1) == '.'))) {
+            ++i;
+            continue;
+        }
+        int start = i;
+        while (i < block.end && isIdentChar(text.at(i))) ++i;
+        QString name = text.mid(start, i - start).toLower();
+        if (declare && !mIndex->mCurrent.declarations.contains(name)) {
+            SymbolIndex::Location loc;
+            loc.file = mIndex->mCurrentFile;
+            loc.line = line;
+            loc.column = start;
+            loc.type = mType;
+            mIndex->mCurrent.declarations.insert(name, loc);
+        }
+        declare = false;
+        mIndex->mCurrent.usages[name] << SymbolIndex::Site {line, start};
+    }
+}
+
+SymbolIndex::SymbolType SymbolScanner::declarationType(const QString &keyword)
+{
+    QString key = keyword.toLower();
+    if (key.startsWith("set") || key.startsWith("alias")) return SymbolIndex::stSet;
+    if (key.startsWith("parameter") || key.startsWith("scalar") || key.startsWith("table"))
+        return SymbolIndex::stParameter;
+    if (key.startsWith("variable")) return SymbolIndex::stVariable;
+    if (key.startsWith("equation")) return SymbolIndex::stEquation;
+    if (key.startsWith("model")) return SymbolIndex::stModel;
+    return SymbolIndex::stUnknown;
+}
+
+
+SymbolIndex::SymbolIndex(QObject *parent) : QObject(parent)
+{
+    mDoc = new QTextDocument(this);
+    mDoc->setUndoRedoEnabled(false);
+    mScanner = new SymbolScanner(mDoc, this);
+    mScanner->pause();
+    mTimer.setInterval(CScanInterval);
+    connect(&mTimer, &QTimer::timeout, this, &SymbolIndex::processQueue);
+    connect(&mReader, &QFutureWatcher<QStringList>::finished, this, &SymbolIndex::fileRead);
+}
+
+SymbolIndex::~SymbolIndex()
+{
+    mTimer.stop();
+    mReader.waitForFinished();
+    mScanner->abortHighlighting();
+}
+
+void SymbolIndex::updateFile(const QString &file)
+{
+    if (!mQueue.contains(file)) mQueue << file;
+    if (!mTimer.isActive()) mTimer.start();
+}
+
+void SymbolIndex::removeFile(const QString &file)
+{
+    mQueue.removeAll(file);
+    if (mReadingFile == file)
+        mReadingFile.clear();
+    if (mCurrentFile == file) {
+        mScanner->pause();
+        mCurrentFile.clear();
+        mSlices.clear();
+        mCurrent = FileIndex();
+    }
+    if (mFiles.contains(file)) {
+        dropUsages(file);
+        mFiles.remove(file);
+        dropDeclarations(file);
+        emit indexChanged();
+    }
+}
+
+bool SymbolIndex::contains(const QString &file) const
+{
+    return mFiles.contains(file) || mQueue.contains(file) || mReadingFile == file || mCurrentFile == file;
+}
+
+bool SymbolIndex::isIndexing() const
+{
+    return mTimer.isActive();
+}
+
+SymbolIndex::Location SymbolIndex::declaration(const QString &symbol) const
+{
+    return mDeclarations.value(symbol.toLower());
+}
+
+QVector<SymbolIndex::Location> SymbolIndex::usages(const QString &symbol) const
+{
+    QVector<Location> res;
+    QString name = symbol.toLower();
+    Location decl = mDeclarations.value(name);
+    const QHash<QString, QVector<Site>> files = mUsages.value(name);
+    for (auto it = files.constBegin(); it != files.constEnd(); ++it) {
+        for (const Site &site: it.value()) {
+            Location loc;
+            loc.file = it.key();
+            loc.line = site.line;
+            loc.column = site.column;
+            loc.type = decl.type;
+            res << loc;
+        }
+    }
+    return res;
+}
+
+void SymbolIndex::processQueue()
+{
+    if (mReader.isRunning()) return;
+    if (!mCurrentFile.isEmpty()) {
+        // the scanner continues in slices from the event loop
+        if (mScanner->hasDirtyBlocks()) return;
+        if (!mSlices.isEmpty()) {
+            appendSlice();
+            return;
+        }
+        finishFile();
+        // the next file is started on the next tick to yield to the event loop
+        return;
+    }
+    if (mQueue.isEmpty()) {
+        mTimer.stop();
+        mDoc->clear();
+        return;
+    }
+    readFile(mQueue.takeFirst());
+}
+
+void SymbolIndex::readFile(const QString &file)
+{
+    QFileInfo fi(file);
+    if (fi.size() > CMaxFileSize) {
+        DEB() << "Symbol index: skipped " << file << " (" << fi.size() / 1024 / 1024 << " MB)";
+        return;
+    }
+    mReadingFile = file;
+    mReader.setFuture(QtConcurrent::run([file]() {
+        QStringList slices;
+        QFile f(file);
+        if (!f.open(QFile::ReadOnly | QFile::Text)) {
+            DEB() << "Symbol index: can't read " << file;
+            return slices;
+        }
+        QTextStream in(&f);
+        QString text = in.readAll();
+        // cut the text behind a line break so each slice continues the last (empty) block of the document
+        int pos = 0;
+        while (pos < text.length()) {
+            int end = pos + CSliceSize;
+            if (end < text.length()) {
+                int lineEnd = text.lastIndexOf('\n', end - 1);
+                end = lineEnd >= pos ? lineEnd + 1 : end;
+            }
+            slices << text.mid(pos, end - pos);
+            pos = end;
+        }
+        return slices;
+    }));
+}
+
+void SymbolIndex::fileRead()
+{
+    QString file = mReadingFile;
+    mReadingFile.clear();
+    // the file may have been removed while it was read
+    if (file.isEmpty()) return;
+    startFile(file, mReader.result());
+}
+
+void SymbolIndex::startFile(const QString &file, const QStringList &slices)
+{
+    mScanner->pause();
+    mDoc->clear();
+    mCurrentFile = file;
+    mSlices = slices;
+    mCurrent = FileIndex();
+    mScanner->reset();
+    mScanner->resume();
+}
+
+void SymbolIndex::appendSlice()
+{
+    // the scanner highlights the new blocks from the contentsChange of the document
+    QTextCursor cursor(mDoc);
+    cursor.movePosition(QTextCursor::End);
+    cursor.insertText(mSlices.takeFirst());
+}
+
+void SymbolIndex::finishFile()
+{
+    if (mFiles.contains(mCurrentFile))
+        dropUsages(mCurrentFile);
+    dropDeclarations(mCurrentFile);
+    for (auto it = mCurrent.declarations.constBegin(); it != mCurrent.declarations.constEnd(); ++it) {
+        if (!mDeclarations.contains(it.key()))
+            mDeclarations.insert(it.key(), it.value());
+    }
+    for (auto it = mCurrent.usages.constBegin(); it != mCurrent.usages.constEnd(); ++it)
+        mUsages[it.key()].insert(mCurrentFile, it.value());
+    mFiles.insert(mCurrentFile, mCurrent);
+    mCurrentFile.clear();
+    mCurrent = FileIndex();
+    emit indexChanged();
+}
+
+void SymbolIndex::dropDeclarations(const QString &file)
+{
+    QStringList dropped;
+    for (auto it = mDeclarations.begin(); it != mDeclarations.end(); ) {
+        if (it.value().file == file) {
+            dropped << it.key();
+            it = mDeclarations.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    // another file may declare a dropped symbol too
+    for (const QString &name: dropped) {
+        for (auto it = mFiles.constBegin(); it != mFiles.constEnd(); ++it) {
+            if (it.key() != file && it.value().declarations.contains(name)) {
+                mDeclarations.insert(name, it.value().declarations.value(name));
+                break;
+            }
+        }
+    }
+}
+
+void SymbolIndex::dropUsages(const QString &file)
+{
+    const FileIndex &index = mFiles[file];
+    for (auto it = index.usages.constBegin(); it != index.usages.constEnd(); ++it) {
+        auto usage = mUsages.find(it.key());
+        if (usage == mUsages.end()) continue;
+        usage.value().remove(file);
+        if (usage.value().isEmpty()) mUsages.erase(usage);
+    }
+}
+
+} // namespace syntax
+} // namespace studio
+} // namespace gams
@@ -0,0 +1,116 @@
+/*
+ * This file is part of the GAMS Studio project.
+ *
+ * Copyright (c) 2017-2020 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2020 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef SYMBOLINDEX_H
+#define SYMBOLINDEX_H
+
+#include <QObject>
+#include <QHash>
+#include <QVector>
+#include <QStringList>
+#include <QTimer>
+#include <QFutureWatcher>
+
+class QTextDocument;
+
+namespace gams {
+namespace studio {
+namespace syntax {
+
+class SymbolScanner;
+
+///
+/// \brief The SymbolIndex collects the declarations and usages of GAMS symbols from a set of source files.
+/// \details The files are scanned one after another in the background using the syntax of the
+/// SyntaxHighlighter, so the index is available without running GAMS. The files are read on a worker thread and
+/// split into slices of at most CSliceSize characters that are handed to the scanner one per tick, files above
+/// CMaxFileSize are skipped.
+///
+class SymbolIndex : public QObject
+{
+    Q_OBJECT
+public:
+    enum SymbolType { stUnknown, stSet, stParameter, stVariable, stEquation, stModel };
+    struct Location {
+        QString file;
+        int line = -1;
+        int column = -1;
+        SymbolType type = stUnknown;
+        bool isValid() const { return line >= 0; }
+    };
+
+    explicit SymbolIndex(QObject *parent = nullptr);
+    ~SymbolIndex() override;
+
+    void updateFile(const QString &file);
+    void removeFile(const QString &file);
+    bool contains(const QString &file) const;
+    bool isIndexing() const;
+
+    Location declaration(const QString &symbol) const;
+    QVector<Location> usages(const QString &symbol) const;
+
+signals:
+    void indexChanged();
+
+private slots:
+    void processQueue();
+    void fileRead();
+
+private:
+    friend class SymbolScanner;
+    struct Site {
+        int line;
+        int column;
+    };
+    struct FileIndex {
+        QHash<QString, Location> declarations;
+        QHash<QString, QVector<Site>> usages;
+    };
+    void readFile(const QString &file);
+    void startFile(const QString &file, const QStringList &slices);
+    void appendSlice();
+    void finishFile();
+    void dropDeclarations(const QString &file);
+    void dropUsages(const QString &file);
+
+private:
+    static const int CScanInterval = 5;         // ms between checks of the running scan
+    static const qint64 CMaxFileSize = 8*1024*1024; // larger files are not indexed
+    static const int CSliceSize = 64*1024;      // max characters added to the scanned document per tick
+
+    QHash<QString, FileIndex> mFiles;
+    QHash<QString, Location> mDeclarations;     // first declaration of each (lower case) symbol
+    QHash<QString, QHash<QString, QVector<Site>>> mUsages; // usage sites of each (lower case) symbol per file
+    QStringList mQueue;
+    QFutureWatcher<QStringList> mReader;
+    QString mReadingFile;
+    QString mCurrentFile;
+    QStringList mSlices;                        // remaining text slices of the current file
+    FileIndex mCurrent;
+    QTimer mTimer;
+    QTextDocument *mDoc = nullptr;
+    SymbolScanner *mScanner = nullptr;
+};
+
+} // namespace syntax
+} // namespace studio
+} // namespace gams
+
+#endif // SYMBOLINDEX_H
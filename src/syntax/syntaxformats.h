@@ -168,7 +168,7 @@ public:
 protected:
     static const QVector<QChar> cSpecialCharacters;  // other breaking kind
 
-    inline int charClass(QChar ch, int &prev, QVector<QChar> moreSpecialChars = QVector<QChar>()) {
+    inline int charClass(QChar ch, int &prev, const QVector<QChar> &moreSpecialChars = QVector<QChar>()) {
         // ASCII:   "   $   '   .   0  9   ;   =   A  Z   _   a   z
         // Code:   34, 36, 39, 46, 48-57, 59, 61, 65-90, 95, 97-122
         if (ch < '"' || ch > 'z')
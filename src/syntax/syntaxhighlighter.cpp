@@ -33,7 +33,7 @@ namespace studio {
 namespace syntax {
 
 SyntaxHighlighter::SyntaxHighlighter(QTextDocument* doc)
-    : BaseHighlighter(doc)
+    : BaseHighlighter(doc), mKinds(int(SyntaxKind::KindCount), nullptr)
 {
     // TODO(JM) Check what additional kinds belong here too (kinds that won't be passed to the next line)
     mSingleLineKinds << SyntaxKind::Directive << SyntaxKind::DirectiveBody << SyntaxKind::CommentEndline
@@ -100,15 +100,29 @@ SyntaxHighlighter::SyntaxHighlighter(QTextDocument* doc)
 
     initKind(new SyntaxTableAssign(SyntaxKind::IdentifierTableAssignmentHead), Scheme::Syntax_tableHeader);
     initKind(new SyntaxTableAssign(SyntaxKind::IdentifierTableAssignmentRow), Scheme::Syntax_identifierAssign);
+
+    initTransitions();
 }
 
 SyntaxHighlighter::~SyntaxHighlighter()
 {
-    Kinds::iterator it = mKinds.begin();
-    while (it != mKinds.end()) {
-        SyntaxAbstract *syn = it.value();
-        it = mKinds.erase(it);
-        delete syn;
+    qDeleteAll(mKinds);
+    mKinds.clear();
+}
+
+void SyntaxHighlighter::initTransitions()
+{
+    // resolve the next kinds of each syntax once, so highlightBlock doesn't need to look them up
+    mTransitions.fill(Candidates(), mKinds.size() * 2);
+    for (SyntaxAbstract *syntax: mKinds) {
+        if (!syntax) continue;
+        for (int emptyLine = 0; emptyLine < 2; ++emptyLine) {
+            Candidates &candidates = mTransitions[syntax->intSyntaxType() * 2 + emptyLine];
+            for (SyntaxKind nextKind: syntax->nextKinds(emptyLine)) {
+                if (SyntaxAbstract *next = kindSyntax(nextKind))
+                    candidates << next;
+            }
+        }
     }
 }
 
@@ -131,7 +145,7 @@ void SyntaxHighlighter::highlightBlock(const QString& text)
     NestingImpact nestingImpact;
     while (index < text.length()) {
         CodeRelation codeRel = mCodes.at(cri);
-        SyntaxAbstract* syntax = mKinds.value(codeRel.blockCode.kind());
+        SyntaxAbstract* syntax = kindSyntax(codeRel.blockCode.kind());
         if (!syntax) {
             DEB() << "no Syntax for " << syntaxKindName(codeRel.blockCode.kind());
             return;
@@ -146,14 +160,13 @@ void SyntaxHighlighter::highlightBlock(const QString& text)
         //   - create a new full set of Syntax in mCodes with just the new one replaced
         // -> result: the top code will change from 0 to the new Standard top
         SyntaxBlock nextBlock;
-        for (SyntaxKind nextKind: syntax->nextKinds(emptyLineKinds)) {
-            SyntaxAbstract* testSyntax = mKinds.value(nextKind);
-            if (testSyntax) {
-                SyntaxBlock testBlock = testSyntax->find(syntax->kind(), tailBlock.flavor, text, index);
-                if (testBlock.isValid()) {
-                    if (!nextBlock.isValid() || nextBlock.start > testBlock.start) {
-                        nextBlock = testBlock;
-                    }
+        for (SyntaxAbstract* testSyntax: mTransitions.at(syntax->intSyntaxType() * 2 + (emptyLineKinds ? 1 : 0))) {
+            SyntaxBlock testBlock = testSyntax->find(syntax->kind(), tailBlock.flavor, text, index);
+            if (testBlock.isValid()) {
+                if (!nextBlock.isValid() || nextBlock.start > testBlock.start) {
+                    nextBlock = testBlock;
+                    // no later candidate can start before the current index
+                    if (nextBlock.start == index) break;
                 }
             }
         }
@@ -177,6 +190,7 @@ void SyntaxHighlighter::highlightBlock(const QString& text)
 //                                  << tailBlock.syntax->kind() << " flav_" << tailBlock.flavor << "  (tail from " << syntax->kind() << ")";
                         scanParentheses(text, tailBlock, syntax->kind(), parPosList, nestingImpact);
                     }
+                    syntaxBlockFound(text, tailBlock);
                     cri = getCode(cri, tailBlock.shift, tailBlock, 0);
                 }
             }
@@ -192,6 +206,7 @@ void SyntaxHighlighter::highlightBlock(const QString& text)
             if (nextBlock.syntax->kind() == SyntaxKind::Semicolon) emptyLineKinds = true;
         }
         scanParentheses(text, nextBlock, syntax->kind(), parPosList, nestingImpact);
+        if (!nextBlock.error) syntaxBlockFound(text, nextBlock);
         index = nextBlock.end;
 
         cri = getCode(cri, nextBlock.shift, nextBlock, 0);
@@ -333,7 +348,8 @@ void SyntaxHighlighter::initKind(int debug, SyntaxAbstract *syntax, Scheme::Colo
 
     // TODO(JM) check if mSingleLineKinds can be left out of mKinds because the code won't be passed to the next line
 //    if (!mSingleLineKinds.contains(syntax->kind())) {}
-    mKinds.insert(syntax->kind(), syntax);
+    delete mKinds.at(syntax->intSyntaxType());
+    mKinds[syntax->intSyntaxType()] = syntax;
 //    addCode(mKinds.length()-1, 0, 0);
 }
 
@@ -345,7 +361,7 @@ void SyntaxHighlighter::initKind(SyntaxAbstract *syntax, Scheme::ColorSlot slot)
 void SyntaxHighlighter::reloadColors()
 {
     for (SyntaxAbstract* syntax: mKinds) {
-        syntax->assignColorSlot(syntax->colorSlot());
+        if (syntax) syntax->assignColorSlot(syntax->colorSlot());
     }
 }
 
@@ -51,6 +51,10 @@ public:
 public slots:
     void syntaxKind(int position, int &intKind);
 
+protected:
+    /// Called for each block of text the syntax has been determined for. Used by scanners like the SymbolIndex.
+    virtual void syntaxBlockFound(const QString &text, const SyntaxBlock &block) { Q_UNUSED(text) Q_UNUSED(block) }
+
 private:
     void scanParentheses(const QString &text, SyntaxBlock block, SyntaxKind preKind, QVector<ParenthesesPos> &parentheses,
                          NestingImpact &nestingImpact);
@@ -64,11 +68,14 @@ private:
         CodeRelationIndex prevCodeRelIndex;
     };
 //    typedef QPair<KindIndex, CodeIndex> KindCodeX;
-    typedef QHash<SyntaxKind, SyntaxAbstract*> Kinds;
+    typedef QVector<SyntaxAbstract*> Kinds;
+    typedef QVector<SyntaxAbstract*> Candidates;
     typedef QList<CodeRelation> CodeRelations;
 
     void initKind(int debug, SyntaxAbstract* syntax, Scheme::ColorSlot slot = Scheme::Syntax_neutral);
     void initKind(SyntaxAbstract* syntax, Scheme::ColorSlot slot = Scheme::Syntax_neutral);
+    void initTransitions();
+    inline SyntaxAbstract *kindSyntax(SyntaxKind kind) const { return mKinds.at(int(kind)); }
 
     int addCode(BlockCode code, CodeRelationIndex parentIndex);
     CodeRelationIndex getCode(CodeRelationIndex cri, SyntaxShift shift, SyntaxBlock block, int nest = 0);
@@ -79,7 +86,8 @@ private:
     int mPositionForSyntaxKind = -1;
     int mLastSyntaxKind = 0;
     QVector<SyntaxKind> mSingleLineKinds;
-    Kinds mKinds;
+    Kinds mKinds;                           // indexed by SyntaxKind
+    QVector<Candidates> mTransitions;       // indexed by SyntaxKind * 2 + emptyLine
     CodeRelations mCodes;
 };
 
@@ -26,6 +26,8 @@
 namespace gams {
 namespace studio {
 
+static const int CMaxDirtyLines = 1000; // above this count of changed lines all lines are marked as dirty
+
 TextMarkRepo::TextMarkRepo(QObject *parent)
     : QObject(parent)
 {
@@ -41,55 +43,75 @@ void TextMarkRepo::init(FileMetaRepo *fileRepo, ProjectRepo *projectRepo)
     mProjectRepo = projectRepo;
 }
 
-void TextMarkRepo::removeMarks(FileId fileId, NodeId groupId, QSet<TextMark::Type> types, int lineNr, int lastLine)
+void TextMarkRepo::removeMarks(FileId fileId, NodeId groupId, const QSet<TextMark::Type> &types, int lineNr, int lastLine)
 {
     removeMarks(fileId, groupId, false, types, lineNr, (lastLine < 0 ? lineNr : lastLine));
 }
 
-void TextMarkRepo::removeMarks(FileId fileId, QSet<TextMark::Type> types, int lineNr, int lastLine)
+void TextMarkRepo::removeMarks(FileId fileId, const QSet<TextMark::Type> &types, int lineNr, int lastLine)
 {
     removeMarks(fileId, NodeId(), true, types, lineNr, (lastLine < 0 ? lineNr : lastLine));
 }
 
-void TextMarkRepo::removeMarks(FileId fileId, NodeId groupId, bool allGroups, QSet<TextMark::Type> types, int lineNr, int lastLine)
+void TextMarkRepo::removeMarks(FileId fileId, NodeId groupId, bool allGroups, const QSet<TextMark::Type> &types,
+                               int lineNr, int lastLine)
 {
     LineMarks* marks = mMarks.value(fileId);
-    if (!marks) return;
-    bool remainingBookmarks = false;
-    QSet<NodeId> groups;
+    if (!marks || marks->isEmpty()) return;
+    bool allTypes = types.isEmpty() || types.contains(TextMark::all);
+    if (!allTypes) {
+        // skip if none of the types is present
+        bool present = false;
+        for (const TextMark::Type &type: types) {
+            if (marks->typeCount(type)) {
+                present = true;
+                break;
+            }
+        }
+        if (!present) return;
+        // a type that holds all marks matches every mark
+        for (const TextMark::Type &type: types) {
+            if (marks->typeCount(type) == marks->size()) {
+                allTypes = true;
+                break;
+            }
+        }
+    }
+    if (!allGroups) {
+        // skip if the group has no marks, and the group check is dropped if it holds all marks
+        int groupCount = marks->groupCount(groupId);
+        if (!groupCount) return;
+        if (groupCount == marks->size()) allGroups = true;
+    }
+    bool changed = false;
     QSet<int> changedLines;
-    LineMarks::iterator it = marks->begin();
-    if ((types.isEmpty() || types.contains(TextMark::all)) && lineNr == -1 && allGroups) {
+    if (allTypes && lineNr == -1 && allGroups) {
         // delete all
-        while (it != marks->end()) {
-            changedLines << it.value()->line();
+        for (LineMarks::iterator it = marks->begin(); it != marks->end(); ++it)
             delete *it;
-            ++it;
-        }
-        marks->clear();
+        marks->clearMarks();
     } else {
-        // delete conditionally
-        while (it != marks->end()) {
+        // delete conditionally, restricted to the line range
+        LineMarks::iterator it = (lineNr == -1) ? marks->begin() : marks->lowerBound(lineNr);
+        LineMarks::iterator end = (lineNr == -1) ? marks->end() : marks->upperBound(lastLine);
+        while (it != end) {
             TextMark* mark = (*it);
-            ++it;
-            if ((types.isEmpty() || types.contains(TextMark::all) || types.contains(mark->type()))
-                    && (allGroups || mark->groupId() == groupId)
-                    && (lineNr == -1 || (lineNr <= mark->line() && lastLine >= mark->line())) ) {
-                groups << mark->groupId();
-                marks->remove(mark->line(), mark);
-                changedLines << mark->line();
+            if ((allTypes || types.contains(mark->type())) && (allGroups || mark->groupId() == groupId)) {
+                changed = true;
+                if (changedLines.size() <= CMaxDirtyLines) changedLines << mark->line();
+                it = marks->eraseMark(it);
                 delete mark;
             } else {
-                if (!remainingBookmarks && mark->type() == TextMark::bookmark)
-                    remainingBookmarks = true;
+                ++it;
             }
         }
     }
 
-    if (!remainingBookmarks) mBookmarkedFiles.removeAll(fileId);
-    if (groups.isEmpty()) return;
+    if (!marks->typeCount(TextMark::bookmark)) mBookmarkedFiles.removeAll(fileId);
+    if (!changed) return;
     FileMeta *fm = mFileRepo->fileMeta(fileId);
-    if (fm) fm->marksChanged(changedLines);
+    // too many changed lines are reported as complete change
+    if (fm) fm->marksChanged(changedLines.size() > CMaxDirtyLines ? QSet<int>() : changedLines);
 }
 
 TextMark *TextMarkRepo::createMark(const FileId fileId, TextMark::Type type, int line, int column, int size)
@@ -115,7 +137,7 @@ TextMark *TextMarkRepo::createMark(const FileId fileId, const NodeId groupId, Te
     TextMark* mark = new TextMark(this, fileId, type, groupId);
     mark->setPosition(line, column, size);
     LineMarks *marks = mMarks.value(fileId);
-    marks->insert(mark->line(), mark);
+    marks->addMark(mark);
     if (mark->type() == TextMark::bookmark && !mBookmarkedFiles.contains(fileId))
         mBookmarkedFiles << fileId;
     FileMeta *fm = mFileRepo->fileMeta(fileId);
@@ -222,9 +244,9 @@ QList<TextMark*> TextMarkRepo::marks(FileId fileId, int lineNr, NodeId groupId,
     LineMarks *lMarks = mMarks.value(fileId);
     if (lMarks->isEmpty() || (lineNr >= 0 && !lMarks->contains(lineNr)) ) return res;
 
-    res.reserve(lMarks->size());
     QPair<LineMarks::const_iterator, LineMarks::const_iterator> interval;
     if (lineNr < 0) {
+        res.reserve(lMarks->size());
         interval.first = lMarks->constBegin();
         interval.second = lMarks->constEnd();
     } else {
@@ -260,15 +282,16 @@ void TextMarkRepo::shiftMarks(FileId fileId, int firstLine, int lineShift)
 {
     LineMarks *marks = mMarks.value(fileId);
     if (!marks || !marks->size() || !lineShift) return;
+    // the marks are moved to other lines, the type counts of LineMarks stay valid
     QSet<int> changedLines;
-    changedLines.reserve(marks->size()*2);
     QMutableMapIterator<int, TextMark*> it(*marks);
     QVector<TextMark*> parked;
     if (lineShift < 0) {
         while (it.hasNext()) {
             it.next();
             if (it.key() < firstLine) continue;
-            changedLines << it.value()->line() << (it.value()->line()+lineShift);
+            if (changedLines.size() <= CMaxDirtyLines)
+                changedLines << it.value()->line() << (it.value()->line()+lineShift);
             parked << it.value();
             it.remove();
         }
@@ -277,7 +300,8 @@ void TextMarkRepo::shiftMarks(FileId fileId, int firstLine, int lineShift)
         while (it.hasPrevious()) {
             it.previous();
             if (it.key() < firstLine) break;
-            changedLines << it.value()->line() << (it.value()->line()+lineShift);
+            if (changedLines.size() <= CMaxDirtyLines)
+                changedLines << it.value()->line() << (it.value()->line()+lineShift);
             parked << it.value();
             it.remove();
         }
@@ -287,7 +311,7 @@ void TextMarkRepo::shiftMarks(FileId fileId, int firstLine, int lineShift)
         marks->insert(mark->line(), mark);
     }
     FileMeta *fm = mFileRepo->fileMeta(fileId);
-    if (fm) fm->marksChanged(changedLines);
+    if (fm) fm->marksChanged(changedLines.size() > CMaxDirtyLines ? QSet<int>() : changedLines);
 }
 
 void TextMarkRepo::setDebugMode(bool debug)
@@ -322,15 +346,31 @@ LineMarks::LineMarks() : QMultiMap<int, TextMark *>()
 {
 }
 
+void LineMarks::addMark(TextMark *mark)
+{
+    insert(mark->line(), mark);
+    ++mTypeCount[mark->type()];
+    ++mGroupCount[mark->groupId()];
+}
+
+LineMarks::iterator LineMarks::eraseMark(LineMarks::iterator it)
+{
+    --mTypeCount[it.value()->type()];
+    QHash<NodeId, int>::iterator group = mGroupCount.find(it.value()->groupId());
+    if (group != mGroupCount.end() && --(*group) <= 0) mGroupCount.erase(group);
+    return erase(it);
+}
+
+void LineMarks::clearMarks()
+{
+    clear();
+    for (int &count : mTypeCount) count = 0;
+    mGroupCount.clear();
+}
+
 bool LineMarks::hasVisibleMarks() const
 {
-    QMultiMap<int, TextMark*>::const_iterator it;
-    for (it = begin() ; it != end() ; ++it) {
-        if ((it.value()->type() == TextMark::link) || (it.value()->type() == TextMark::error)
-                || (it.value()->type() == TextMark::bookmark))
-            return true;
-    }
-    return false;
+    return mTypeCount[TextMark::link] || mTypeCount[TextMark::error] || mTypeCount[TextMark::bookmark];
 }
 
 } // namespace studio
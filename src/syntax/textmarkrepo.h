@@ -30,10 +30,20 @@ namespace studio {
 class FileMetaRepo;
 class ProjectRepo;
 
+///
+/// class LineMarks
+/// Marks of a file sorted by line. The counts of each type and of each group are kept to answer type and group
+/// queries without iterating. Changes have to pass addMark, eraseMark and clearMarks to keep the counts valid.
+///
 class LineMarks: public QMultiMap<int, TextMark*>
 {
 public:
     LineMarks();
+    void addMark(TextMark *mark);
+    iterator eraseMark(iterator it);
+    void clearMarks();
+    inline int typeCount(TextMark::Type type) const { return type < TextMark::all ? mTypeCount[type] : size(); }
+    inline int groupCount(NodeId groupId) const { return mGroupCount.value(groupId); }
     bool hasVisibleMarks() const;
     TextMark* firstError(NodeId groupId) const {
         if (isEmpty()) return nullptr;
@@ -47,6 +57,9 @@ public:
         }
         return res;
     }
+private:
+    int mTypeCount[TextMark::all] = {0, 0, 0, 0, 0};
+    QHash<NodeId, int> mGroupCount;
 };
 
 class TextMarkRepo: public QObject
@@ -57,8 +70,10 @@ public:
     ~TextMarkRepo() override;
     void init(FileMetaRepo *fileRepo, ProjectRepo *projectRepo);
 
-    void removeMarks(FileId fileId, NodeId groupId, QSet<TextMark::Type> types = QSet<TextMark::Type>(), int lineNr = -1, int lastLine = -1);
-    void removeMarks(FileId fileId, QSet<TextMark::Type> types = QSet<TextMark::Type>(), int lineNr = -1, int lastLine = -1);
+    void removeMarks(FileId fileId, NodeId groupId, const QSet<TextMark::Type> &types = QSet<TextMark::Type>(),
+                     int lineNr = -1, int lastLine = -1);
+    void removeMarks(FileId fileId, const QSet<TextMark::Type> &types = QSet<TextMark::Type>(), int lineNr = -1,
+                     int lastLine = -1);
     TextMark* createMark(const FileId fileId, TextMark::Type type, int line, int column, int size = 0);
     TextMark* createMark(const FileId fileId, const NodeId groupId, TextMark::Type type, int value, int line, int column, int size = 0);
     bool hasBookmarks(FileId fileId);
@@ -87,7 +102,8 @@ private:
 
 private:
     FileId ensureFileId(QString location);
-    void removeMarks(FileId fileId, NodeId groupId, bool allGroups, QSet<TextMark::Type> types, int lineNr, int lastLine);
+    void removeMarks(FileId fileId, NodeId groupId, bool allGroups, const QSet<TextMark::Type> &types, int lineNr,
+                     int lastLine);
 
 };
 
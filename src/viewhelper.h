@@ -79,6 +79,15 @@ public:
         return w;
     }
 
+    inline static QWidget* initEditorType(QWidget* w, const QString &restoreLocation) {
+        // a placeholder for a restored tab, the real editor is created when it gets activated
+        if(w) {
+            w->setProperty("EditorType", int(EditorType::placeholder));
+            w->setProperty("restoreLocation", restoreLocation);
+        }
+        return w;
+    }
+
     inline static EditorType editorType(QWidget* w) {
         QVariant v = w ? w->property("EditorType") : QVariant();
         return (v.isValid() ? static_cast<EditorType>(v.toInt()) : EditorType::undefined);
@@ -120,6 +129,12 @@ public:
     inline static option::GamsConfigEditor* toGamsConfigEditor(QWidget* w) {
         return (editorType(w) == EditorType::gucfg) ? static_cast<option::GamsConfigEditor*>(w) : nullptr;
     }
+    inline static bool isPlaceholder(QWidget* w) {
+        return editorType(w) == EditorType::placeholder;
+    }
+    inline static QString restoreLocation(QWidget* w) {
+        return isPlaceholder(w) ? w->property("restoreLocation").toString() : QString();
+    }
 
     inline static QStringList dialogFileFilterUserCreated() {
         return QStringList("GAMS source (*.gms)")
@@ -0,0 +1,403 @@
+/*
+ * This file is part of the GAMS Studio project.
+ *
+ * Copyright (c) 2017-2020 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2020 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "testbenchmarks.h"
+#include "editors/filemapper.h"
+#include "editors/logparser.h"
+#include "editors/memorymapper.h"
+#include "gdxviewer/gdxdatastore.h"
+#include "gdxviewer/gdxsymbol.h"
+#include "gdxviewer/gdxsymboltable.h"
+#include "reference/reference.h"
+#include "search/searchworker.h"
+#include "syntax/syntaxhighlighter.h"
+#include "gdxcc.h"
+
+#include <QApplication>
+#include <QDirIterator>
+#include <QMutex>
+#include <QStandardPaths>
+#include <QTextDocument>
+#include <QThread>
+
+using gams::studio::FileMapper;
+using gams::studio::LogParser;
+using gams::studio::MemoryMapper;
+using gams::studio::gdxviewer::GdxDataStore;
+using gams::studio::gdxviewer::GdxSymbol;
+using gams::studio::gdxviewer::GdxSymbolTable;
+using gams::studio::reference::Reference;
+using gams::studio::search::Result;
+using gams::studio::search::SearchFile;
+using gams::studio::search::SearchWorker;
+using gams::studio::syntax::SyntaxHighlighter;
+
+static const int CTextLines = 500000;   // lines of the file for the FileMapper
+static const int CLogLines = 200000;    // lines of the process log for the MemoryMapper
+static const int CModelCopies = 500;    // copies of the model part for the highlighter
+static const int CRefSymbols = 2000;    // symbols in the reference file
+static const int CGdxRows = 1000;       // UELs of the first dimension of the GDX parameter
+static const int CGdxColumns = 500;     // UELs of the second dimension of the GDX parameter
+static const int CSearchDirs = 20;      // directories of the search tree
+static const int CSearchFiles = 50;     // files per directory of the search tree
+static const int CSearchLines = 200;    // lines per file of the search tree
+
+namespace {
+
+// opens a GDX file the way the GdxViewer does
+class GdxFile
+{
+public:
+    GdxFile(const QString &fileName, const QString &dataKey)
+    {
+        char msg[GMS_SSSIZE];
+        QString sysDir = QFileInfo(QStandardPaths::findExecutable("gams")).absolutePath();
+        if (!gdxCreateD(&mGdx, sysDir.toLatin1(), msg, sizeof(msg)))
+            return;
+        int errNr = 0;
+        gdxOpenRead(mGdx, fileName.toLocal8Bit(), &errNr);
+        if (!errNr)
+            mTable = new GdxSymbolTable(mGdx, &mMutex, QTextCodec::codecForName("utf-8"), dataKey);
+    }
+    ~GdxFile()
+    {
+        delete mTable;
+        if (mGdx) {
+            gdxClose(mGdx);
+            gdxFree(&mGdx);
+        }
+    }
+    GdxSymbol *symbol() const
+    {
+        // the first entry is the universe
+        return mTable ? mTable->gdxSymbols().at(1) : nullptr;
+    }
+
+private:
+    gdxHandle_t mGdx = nullptr;
+    QMutex mMutex;
+    GdxSymbolTable *mTable = nullptr;
+};
+
+}
+
+void TestBenchmarks::initTestCase()
+{
+    QVERIFY(mDir.isValid());
+    createTextFile();
+    createModelText();
+    createReferenceFile();
+    createGdxFile();
+    createSearchTree();
+}
+
+void TestBenchmarks::cleanupTestCase()
+{
+    mDir.remove();
+}
+
+void TestBenchmarks::benchFileMapperLineIndex()
+{
+    QBENCHMARK {
+        FileMapper mapper;
+        mapper.setCodec(QTextCodec::codecForName("utf-8"));
+        QVERIFY(mapper.openFile(mTextFile, true));
+        // the editor peeks the chunks from a timer, here they are peeked until all line numbers are known
+        int known = -1;
+        while (known != mapper.knownLineNrs()) {
+            known = mapper.knownLineNrs();
+            mapper.peekChunksForLineNrs();
+        }
+        QVERIFY(mapper.knownLineNrs() >= CTextLines);
+    }
+}
+
+void TestBenchmarks::benchFileMapperScroll()
+{
+    FileMapper mapper;
+    mapper.setCodec(QTextCodec::codecForName("utf-8"));
+    QVERIFY(mapper.openFile(mTextFile, true));
+    mapper.setVisibleLineCount(40);
+    int chars = 0;
+    QBENCHMARK {
+        for (int i = 0; i <= 100; ++i) {
+            mapper.setVisibleTopLine(i / 100.0);
+            chars += mapper.lines(0, 40).length();
+        }
+        mapper.setVisibleTopLine(0.5);
+        for (int i = 0; i < 200; ++i) {
+            mapper.moveVisibleTopLine(i < 100 ? 3 : -3);
+            chars += mapper.lines(0, 40).length();
+        }
+    }
+    QVERIFY(chars > 0);
+}
+
+void TestBenchmarks::benchMemoryMapperIngest()
+{
+    QByteArray log;
+    for (int i = 0; i < CLogLines; ++i) {
+        if (i % 10 == 0)
+            log.append(QString("--- Generating LP model transport%1\n").arg(i).toLatin1());
+        else
+            log.append(QString("--- transport.gms(%1) 4 Mb\n").arg(i).toLatin1());
+    }
+    QBENCHMARK {
+        MemoryMapper mapper;
+        mapper.setCodec(QTextCodec::codecForName("utf-8"));
+        mapper.setLogParser(new LogParser(mapper.codec()));
+        mapper.startRun();
+        // the process output arrives in packets
+        for (int pos = 0; pos < log.size(); pos += 4096)
+            mapper.addProcessData(log.mid(pos, 4096));
+        mapper.endRun();
+        QVERIFY(mapper.lineCount() >= CLogLines);
+    }
+}
+
+void TestBenchmarks::benchSyntaxHighlighter()
+{
+    QTextDocument doc;
+    doc.setPlainText(mModelText);
+    SyntaxHighlighter highlighter(&doc);
+    QBENCHMARK {
+        highlighter.rehighlight();
+        // the highlighter continues in slices from the event loop
+        while (highlighter.hasDirtyBlocks())
+            QCoreApplication::processEvents();
+    }
+}
+
+void TestBenchmarks::benchReferenceParse()
+{
+    QBENCHMARK {
+        Reference ref(mReferenceFile, QTextCodec::codecForName("utf-8"));
+        QCOMPARE(ref.state(), Reference::SuccessfullyLoaded);
+        QCOMPARE(ref.size(), CRefSymbols);
+    }
+}
+
+void TestBenchmarks::benchGdxLoad()
+{
+    int run = 0;
+    QBENCHMARK {
+        // a new data key for each run reads the records through the GDX API
+        GdxFile file(mGdxFile, QString("benchmark-%1").arg(++run));
+        QVERIFY(file.symbol());
+        file.symbol()->loadData();
+        QCOMPARE(file.symbol()->rowCount(), CGdxRows * CGdxColumns);
+    }
+}
+
+void TestBenchmarks::benchGdxReopen()
+{
+    QString dataKey = GdxDataStore::fileKey(mGdxFile);
+    GdxFile first(mGdxFile, dataKey);
+    QVERIFY(first.symbol());
+    first.symbol()->loadData();
+    // the cache file is written in the background after loading, the benchmark has to hit the store
+    int symbolNr = first.symbol()->nr();
+    GdxDataStore::SymbolInfo info;
+    QVERIFY(QTest::qWaitFor([&dataKey, symbolNr, &info]() {
+        return !GdxDataStore::instance()->find(dataKey, symbolNr, info).isNull(); }, 30000));
+    QBENCHMARK {
+        GdxFile file(mGdxFile, dataKey);
+        file.symbol()->loadData();
+        QCOMPARE(file.symbol()->rowCount(), CGdxRows * CGdxColumns);
+    }
+}
+
+void TestBenchmarks::benchGdxSort()
+{
+    GdxFile file(mGdxFile, GdxDataStore::fileKey(mGdxFile));
+    GdxSymbol *sym = file.symbol();
+    QVERIFY(sym);
+    sym->loadData();
+    QBENCHMARK {
+        sym->sort(1, Qt::DescendingOrder);
+        sym->sort(2, Qt::AscendingOrder);
+    }
+}
+
+void TestBenchmarks::benchGdxFilter()
+{
+    GdxFile file(mGdxFile, GdxDataStore::fileKey(mGdxFile));
+    GdxSymbol *sym = file.symbol();
+    QVERIFY(sym);
+    sym->loadData();
+    // hide every other label of the first dimension
+    bool *showUel = sym->showUelInColumn().at(0);
+    std::vector<int> *uels = sym->uelsInColumn().at(0);
+    for (size_t i = 0; i < uels->size(); i += 2)
+        showUel[uels->at(i)] = false;
+    sym->setFilterActive(0, true);
+    QBENCHMARK {
+        sym->filterRows();
+    }
+    QCOMPARE(sym->rowCount(), CGdxRows / 2 * CGdxColumns);
+}
+
+void TestBenchmarks::benchSearchFiles()
+{
+    QList<SearchFile> files;
+    QDirIterator it(mSearchDir, QStringList() << "*.gms", QDir::Files, QDirIterator::Subdirectories);
+    while (it.hasNext())
+        files << SearchFile {it.next(), QTextCodec::codecForName("utf-8")};
+    QCOMPARE(files.size(), CSearchDirs * CSearchFiles);
+    QBENCHMARK {
+        // the worker runs in its own thread as in the search dialog
+        QList<Result> results;
+        QThread thread;
+        SearchWorker *worker = new SearchWorker(files, QRegularExpression("x\\(i,\\s*j\\)"), &results);
+        worker->moveToThread(&thread);
+        connect(&thread, &QThread::started, worker, &SearchWorker::findInFiles);
+        connect(&thread, &QThread::finished, worker, &QObject::deleteLater);
+        thread.start();
+        thread.wait();
+        QVERIFY(!results.isEmpty());
+    }
+}
+
+void TestBenchmarks::createTextFile()
+{
+    mTextFile = mDir.filePath("textfile.txt");
+    QFile file(mTextFile);
+    QVERIFY(file.open(QFile::WriteOnly));
+    QTextStream stream(&file);
+    for (int line = 1; line <= CTextLines; ++line)
+        stream << "This is line " << line << " of the benchmark file with some additional text.\n";
+}
+
+void TestBenchmarks::createModelText()
+{
+    QString part =
+            "$title generated benchmark model\n"
+            "* comment line\n"
+            "Set i 'canning plants' / seattle, san-diego /\n"
+            "    j 'markets'        / new-york, chicago, topeka /;\n"
+            "Parameter a(i) 'capacity' / seattle 350, san-diego 600 /;\n"
+            "Table d(i,j) 'distance in thousands of miles'\n"
+            "              new-york  chicago  topeka\n"
+            "   seattle         2.5      1.7     1.8\n"
+            "   san-diego       2.5      1.8     1.4;\n"
+            "Scalar f 'freight' / 90 /;\n"
+            "Variable x(i,j), z;\n"
+            "Positive Variable x;\n"
+            "Equation cost, supply(i);\n"
+            "cost..      z =e= sum((i,j), f*d(i,j)*x(i,j)/1000);  !! end of line comment\n"
+            "supply(i).. sum(j, x(i,j)) =l= a(i);\n"
+            "$onText\n"
+            "block comment\n"
+            "$offText\n"
+            "Model transport / all /;\n"
+            "option lp = cplex;\n"
+            "solve transport using lp minimizing z;\n"
+            "display x.l, x.m;\n";
+    mModelText.reserve(part.length() * CModelCopies);
+    for (int i = 0; i < CModelCopies; ++i)
+        mModelText += part;
+}
+
+void TestBenchmarks::createReferenceFile()
+{
+    mReferenceFile = mDir.filePath("model.ref");
+    QFile file(mReferenceFile);
+    QVERIFY(file.open(QFile::WriteOnly));
+    QTextStream stream(&file);
+    QString location = QDir::toNativeSeparators(mDir.filePath("model.gms"));
+    QStringList types {"SET", "PARAM", "VAR", "EQU"};
+    QStringList references {"declared", "defined", "assigned", "ref", "ref", "ref", "ref", "control"};
+    int idx = 0;
+    for (int id = 1; id <= CRefSymbols; ++id) {
+        for (int r = 0; r < references.size(); ++r) {
+            stream << ++idx << ' ' << id << " sym" << id << ' ' << types.at(id % types.size()) << ' '
+                   << references.at(r) << " 0 " << (id * 10 + r) << " 5 0 1 " << location << '\n';
+        }
+    }
+    // the symbol table: id, name, type, user info, dimension, number of elements and explanatory text
+    stream << "0 " << CRefSymbols << '\n';
+    for (int id = 1; id <= CRefSymbols; ++id)
+        stream << id << " sym" << id << " 1 0 0 1 explanatory text of symbol " << id << '\n';
+}
+
+void TestBenchmarks::createGdxFile()
+{
+    mGdxFile = mDir.filePath("benchmark.gdx");
+    gdxHandle_t gdx;
+    char msg[GMS_SSSIZE];
+    QString sysDir = QFileInfo(QStandardPaths::findExecutable("gams")).absolutePath();
+    QVERIFY2(gdxCreateD(&gdx, sysDir.toLatin1(), msg, sizeof(msg)), msg);
+    int errNr = 0;
+    gdxOpenWrite(gdx, mGdxFile.toLocal8Bit(), "Studio benchmark", &errNr);
+    QCOMPARE(errNr, 0);
+
+    gdxUELRegisterRawStart(gdx);
+    for (int i = 1; i <= CGdxRows; ++i)
+        gdxUELRegisterRaw(gdx, QString("row%1").arg(i).toLatin1());
+    for (int j = 1; j <= CGdxColumns; ++j)
+        gdxUELRegisterRaw(gdx, QString("col%1").arg(j).toLatin1());
+    gdxUELRegisterDone(gdx);
+
+    int keys[GMS_MAX_INDEX_DIM];
+    double values[GMS_VAL_MAX];
+    gdxDataWriteRawStart(gdx, "p", "benchmark parameter", 2, GMS_DT_PAR, 0);
+    for (int i = 1; i <= CGdxRows; ++i) {
+        for (int j = 1; j <= CGdxColumns; ++j) {
+            keys[0] = i;
+            keys[1] = CGdxRows + j;
+            values[GMS_VAL_LEVEL] = ((i * 7919 + j * 104729) % 100000) / 100.0;
+            gdxDataWriteRaw(gdx, keys, values);
+        }
+    }
+    gdxDataWriteDone(gdx);
+    gdxClose(gdx);
+    gdxFree(&gdx);
+}
+
+void TestBenchmarks::createSearchTree()
+{
+    mSearchDir = mDir.filePath("search");
+    for (int d = 0; d < CSearchDirs; ++d) {
+        QDir dir(mSearchDir + QString("/dir%1").arg(d));
+        QVERIFY(dir.mkpath("."));
+        for (int f = 0; f < CSearchFiles; ++f) {
+            QFile file(dir.filePath(QString("file%1.gms").arg(f)));
+            QVERIFY(file.open(QFile::WriteOnly));
+            QTextStream stream(&file);
+            for (int line = 0; line < CSearchLines; ++line) {
+                if (line % 10 == 0)
+                    stream << "supply(i).. sum(j, x(i,j)) =l= a(i);\n";
+                else
+                    stream << "* some comment line " << line << " without the pattern\n";
+            }
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    QApplication app(argc, argv);
+    TestBenchmarks test;
+    QStringList args = app.arguments();
+    if (!args.contains("-o")) {
+        // keep a machine-readable copy of the results to compare versions
+        args << "-o" << "testbenchmarks.xml,xml" << "-o" << "-,txt";
+    }
+    return QTest::qExec(&test, args);
+}
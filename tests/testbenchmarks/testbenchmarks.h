@@ -0,0 +1,66 @@
+/*
+ * This file is part of the GAMS Studio project.
+ *
+ * Copyright (c) 2017-2020 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2020 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef TESTBENCHMARKS_H
+#define TESTBENCHMARKS_H
+
+#include <QtTest/QTest>
+#include <QTemporaryDir>
+
+///
+/// \brief Benchmarks of the Studio hot paths on generated data.
+/// \details Unless an output is given on the command line the results are written as text to the console
+/// and as XML to testbenchmarks.xml, which can be compared between versions.
+///
+class TestBenchmarks : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void benchFileMapperLineIndex();
+    void benchFileMapperScroll();
+    void benchMemoryMapperIngest();
+    void benchSyntaxHighlighter();
+    void benchReferenceParse();
+    void benchGdxLoad();
+    void benchGdxReopen();
+    void benchGdxSort();
+    void benchGdxFilter();
+    void benchSearchFiles();
+
+private:
+    void createTextFile();
+    void createModelText();
+    void createReferenceFile();
+    void createGdxFile();
+    void createSearchTree();
+
+private:
+    QTemporaryDir mDir;
+    QString mTextFile;
+    QString mModelText;
+    QString mReferenceFile;
+    QString mGdxFile;
+    QString mSearchDir;
+};
+
+#endif // TESTBENCHMARKS_H
@@ -0,0 +1,103 @@
+#
+# This file is part of the GAMS Studio project.
+#
+# Copyright (c) 2017-2020 GAMS Software GmbH <support@gams.com>
+# Copyright (c) 2017-2020 GAMS Development Corp. <support@gams.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program. If not, see <http://www.gnu.org/licenses/>.
+#
+
+TEMPLATE = app
+
+include(../tests.pri)
+
+QT += concurrent
+
+INCLUDEPATH += $$SRCPATH \
+               $$SRCPATH/editors \
+               $$SRCPATH/gdxviewer \
+               $$SRCPATH/syntax
+
+HEADERS += \
+    $$SRCPATH/diagnostics.h \
+    testbenchmarks.h \
+    $$SRCPATH/editors/abstracttextmapper.h \
+    $$SRCPATH/editors/filemapper.h \
+    $$SRCPATH/editors/logparser.h \
+    $$SRCPATH/editors/memorymapper.h \
+    $$SRCPATH/file/dynamicfile.h \
+    $$SRCPATH/gdxviewer/gdxdatastore.h \
+    $$SRCPATH/gdxviewer/gdxsymbol.h \
+    $$SRCPATH/gdxviewer/gdxsymboltable.h \
+    $$SRCPATH/gdxviewer/symbolstatistics.h \
+    $$SRCPATH/gdxviewer/uelindex.h \
+    $$SRCPATH/gdxviewer/valuefilter.h \
+    $$SRCPATH/gdxviewer/valuefilterwidget.h \
+    $$SRCPATH/numerics/doubleFormat.h \
+    $$SRCPATH/numerics/doubleformatter.h \
+    $$SRCPATH/numerics/dtoaLoc.h \
+    $$SRCPATH/reference/reference.h \
+    $$SRCPATH/reference/referencedatatype.h \
+    $$SRCPATH/reference/symboldatatype.h \
+    $$SRCPATH/reference/symbolreferenceitem.h \
+    $$SRCPATH/search/result.h \
+    $$SRCPATH/search/searchworker.h \
+    $$SRCPATH/syntax/basehighlighter.h \
+    $$SRCPATH/syntax/blockdata.h \
+    $$SRCPATH/syntax/syntaxdeclaration.h \
+    $$SRCPATH/syntax/syntaxformats.h \
+    $$SRCPATH/syntax/syntaxhighlighter.h \
+    $$SRCPATH/syntax/syntaxidentifier.h \
+    $$SRCPATH/svgengine.h \
+    $$SRCPATH/scheme.h
+
+SOURCES += \
+    testbenchmarks.cpp \
+    $$SRCPATH/editors/abstracttextmapper.cpp \
+    $$SRCPATH/editors/filemapper.cpp \
+    $$SRCPATH/editors/logparser.cpp \
+    $$SRCPATH/editors/memorymapper.cpp \
+    $$SRCPATH/file/dynamicfile.cpp \
+    $$SRCPATH/gdxviewer/gdxdatastore.cpp \
+    $$SRCPATH/gdxviewer/gdxsymbol.cpp \
+    $$SRCPATH/gdxviewer/gdxsymboltable.cpp \
+    $$SRCPATH/gdxviewer/symbolstatistics.cpp \
+    $$SRCPATH/gdxviewer/uelindex.cpp \
+    $$SRCPATH/gdxviewer/valuefilter.cpp \
+    $$SRCPATH/gdxviewer/valuefilterwidget.cpp \
+    $$SRCPATH/numerics/doubleFormat.c \
+    $$SRCPATH/numerics/doubleformatter.cpp \
+    $$SRCPATH/numerics/dtoaLoc.c \
+    $$SRCPATH/reference/reference.cpp \
+    $$SRCPATH/reference/referencedatatype.cpp \
+    $$SRCPATH/reference/symboldatatype.cpp \
+    $$SRCPATH/reference/symbolreferenceitem.cpp \
+    $$SRCPATH/search/result.cpp \
+    $$SRCPATH/search/searchworker.cpp \
+    $$SRCPATH/syntax/basehighlighter.cpp \
+    $$SRCPATH/syntax/blockdata.cpp \
+    $$SRCPATH/syntax/syntaxdeclaration.cpp \
+    $$SRCPATH/syntax/syntaxformats.cpp \
+    $$SRCPATH/syntax/syntaxhighlighter.cpp \
+    $$SRCPATH/syntax/syntaxidentifier.cpp \
+    $$SRCPATH/diagnostics.cpp \
+    $$SRCPATH/editors/defaultsystemlogger.cpp \
+    $$SRCPATH/editors/sysloglocator.cpp \
+    $$SRCPATH/exception.cpp \
+    $$SRCPATH/logger.cpp \
+    $$SRCPATH/svgengine.cpp \
+    $$SRCPATH/scheme.cpp
+
+FORMS += \
+    $$SRCPATH/gdxviewer/valuefilterwidget.ui
@@ -0,0 +1,114 @@
+/*
+ * This file is part of the GAMS Studio project.
+ *
+ * Copyright (c) 2017-2020 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2020 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "testfilechangewatcher.h"
+#include "file/filechangewatcher.h"
+
+#include <QDir>
+#include <QFile>
+#include <QSignalSpy>
+
+using gams::studio::FileChangeWatcher;
+
+void TestFileChangeWatcher::init()
+{
+    mDir = new QTemporaryDir();
+    QVERIFY(mDir->isValid());
+}
+
+void TestFileChangeWatcher::cleanup()
+{
+    delete mDir;
+    mDir = nullptr;
+}
+
+QString TestFileChangeWatcher::writeFile(const QString &name, const QByteArray &content)
+{
+    QString fileName = mDir->filePath(name);
+    QFile file(fileName);
+    if (!file.open(QFile::WriteOnly)) return QString();
+    file.write(content);
+    file.close();
+    return fileName;
+}
+
+void TestFileChangeWatcher::testBatchedChanges()
+{
+    FileChangeWatcher watcher;
+    QSignalSpy spy(&watcher, &FileChangeWatcher::filesChanged);
+    QString file1 = writeFile("batch1.gms", "a");
+    QString file2 = writeFile("batch2.gms", "a");
+    // in-place writes are reported by the file watches of open files
+    QVERIFY(watcher.watch(file1, true));
+    QVERIFY(watcher.watch(file2, true));
+
+    // the changes have a different size, so the test doesn't depend on the mtime resolution
+    writeFile("batch1.gms", "changed");
+    writeFile("batch2.gms", "changed");
+    QTRY_VERIFY_WITH_TIMEOUT(spy.count() > 0, 5000);
+    QTest::qWait(500);
+    QCOMPARE(spy.count(), 1);
+    QStringList changed = spy.at(0).at(0).toStringList();
+    QCOMPARE(changed.size(), 2);
+    QVERIFY(changed.contains(file1));
+    QVERIFY(changed.contains(file2));
+}
+
+void TestFileChangeWatcher::testUnwatchWhilePolling()
+{
+    // files of a missing directory are polled
+    FileChangeWatcher watcher;
+    QSignalSpy spy(&watcher, &FileChangeWatcher::filesAppeared);
+    QString polled = mDir->filePath("missing1/polled.gms");
+    QVERIFY(!watcher.watch(polled));
+    QVERIFY(QTest::qWaitFor([&watcher]() { return watcher.isPolling(); }, 5000));
+
+    // unwatching the only polled file before its batch is scanned has to finish the poll
+    watcher.unwatch(polled);
+    QTRY_VERIFY_WITH_TIMEOUT(!watcher.isPolling(), 1000);
+
+    // polling continues for further files
+    QString later = mDir->filePath("missing2/later.gms");
+    QVERIFY(!watcher.watch(later));
+    QVERIFY(QDir(mDir->path()).mkdir("missing2"));
+    QCOMPARE(writeFile("missing2/later.gms", "a"), later);
+    QTRY_VERIFY_WITH_TIMEOUT(spy.count() > 0, 10000);
+    QVERIFY(spy.at(0).at(0).toStringList().contains(later));
+}
+
+void TestFileChangeWatcher::testAtomicRewrite()
+{
+    FileChangeWatcher watcher;
+    QSignalSpy spy(&watcher, &FileChangeWatcher::filesChanged);
+    QString file = writeFile("rewrite.gms", "a");
+    QVERIFY(watcher.watch(file, true));
+    QVERIFY(watcher.hasFileWatch(file));
+
+    // write a temporary file and replace the original, as editors and tools commonly do
+    QString temp = writeFile("rewrite.gms.tmp", "rewritten");
+    QVERIFY(QFile::remove(file));
+    QVERIFY(QFile::rename(temp, file));
+    QTRY_VERIFY_WITH_TIMEOUT(spy.count() > 0, 5000);
+    QVERIFY(spy.last().at(0).toStringList().contains(file));
+
+    // the replaced file has to be watched again
+    QTRY_VERIFY_WITH_TIMEOUT(watcher.hasFileWatch(file), 5000);
+}
+
+QTEST_MAIN(TestFileChangeWatcher)
@@ -26,6 +26,7 @@ INCLUDEPATH += $$SRCPATH \
                $$SRCPATH/editors
 
 HEADERS += \
+    $$SRCPATH/diagnostics.h \
     $$SRCPATH/editors/filemapper.h \
     $$SRCPATH/editors/abstracttextmapper.h \
     testfilemapper.h
@@ -33,6 +34,9 @@ HEADERS += \
 SOURCES += \
     $$SRCPATH/editors/filemapper.cpp \
     $$SRCPATH/editors/abstracttextmapper.cpp \
+    $$SRCPATH/diagnostics.cpp \
+    $$SRCPATH/editors/defaultsystemlogger.cpp \
+    $$SRCPATH/editors/sysloglocator.cpp \
     $$SRCPATH/exception.cpp \
     $$SRCPATH/logger.cpp \
     testfilemapper.cpp
@@ -103,6 +103,26 @@ void TestMemoryMapper::testAddLine()
     DEB() << "LINES:\n" << mMapper->lines(3,7);
 }
 
+void TestMemoryMapper::testSpillChunks()
+{
+    // with chunks of 128 bytes this log exceeds the chunks kept in memory
+    mMapper->setLogParser(new gams::studio::LogParser(mMapper->codec()));
+    for (int i = 0; i < 300; ++i) {
+        mMapper->addProcessData(QString("line %1\n").arg(i, 3, 10, QChar('0')).toLatin1());
+    }
+    QVERIFY(mMapper->lineCount() >= 300);
+
+    // the head of the run is paged back in from disk
+    mMapper->setVisibleTopLine(0);
+    QCOMPARE(mMapper->lines(0, 1), QString("line 000"));
+    QCOMPARE(mMapper->lines(1, 1), QString("line 001"));
+
+    // the tail of the run is still in memory
+    mMapper->setVisibleTopLine(290);
+    QCOMPARE(mMapper->lines(0, 1), QString("line 290"));
+    QCOMPARE(mMapper->lines(3, 1), QString("line 293"));
+}
+
 //void TestMemoryMapper::testReadChunk0()
 //{
 //    int max = 1234567890;
@@ -34,6 +34,7 @@ private slots:
     void cleanup();
 
     void testAddLine();
+    void testSpillChunks();
 
 //    void testReadChunk0();
 //    void testReadChunk1();
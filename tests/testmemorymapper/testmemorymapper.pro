@@ -26,6 +26,7 @@ INCLUDEPATH += $$SRCPATH \
                $$SRCPATH/editors
 
 HEADERS += \
+    $$SRCPATH/diagnostics.h \
     $$SRCPATH/editors/abstracttextmapper.h \
     $$SRCPATH/editors/logparser.h \
     $$SRCPATH/editors/memorymapper.h \
@@ -39,6 +40,9 @@ SOURCES += \
     $$SRCPATH/editors/logparser.cpp \
     $$SRCPATH/editors/memorymapper.cpp \
     $$SRCPATH/file/dynamicfile.cpp \
+    $$SRCPATH/diagnostics.cpp \
+    $$SRCPATH/editors/defaultsystemlogger.cpp \
+    $$SRCPATH/editors/sysloglocator.cpp \
     $$SRCPATH/exception.cpp \
     $$SRCPATH/logger.cpp \
     $$SRCPATH/svgengine.cpp \
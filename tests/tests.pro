@@ -22,6 +22,7 @@ TEMPLATE = subdirs
 
 SUBDIRS +=                              \
            testabstractprocess          \
+           testbenchmarks               \
            testblockcode                \
            testcheckforupdatewrapper    \
            testcommonpaths              \
@@ -30,6 +31,7 @@ SUBDIRS +=                              \
            testdialogfilefilter         \
            testdoclocation              \
            testeditors                  \
+           testfilechangewatcher        \
            testgamslicenseinfo          \
            testgamsoption               \
            testgamsuserconfig           \
@@ -40,5 +42,6 @@ SUBDIRS +=                              \
            testoptionapi                \
            testsettings                 \
            testservicelocators          \
-           testsolverconfiginfo
+           testsolverconfiginfo         \
+           testsyntaxhighlighter
 #           testfilemapper               \
@@ -156,6 +156,10 @@ void removeSettingFiles() {
     if (f2.exists()) {
         Q_ASSERT(f2.remove());
     }
+    QFile f3("./GAMS/studio.snapshot");
+    if (f3.exists()) {
+        Q_ASSERT(f3.remove());
+    }
 }
 
 void TestSettings::testChangeValueAtRoot()
@@ -328,4 +332,32 @@ void TestSettings::testIgnoreIfNoFilesExist()
     Q_ASSERT(!file.exists());
 }
 
+void TestSettings::testSnapshotKeys()
+{
+    removeSettingFiles();
+    Settings::createSettings(false, true, false);
+    // change snapshot value, save and release settings
+    QVariantList history;
+    QVariantMap entry;
+    entry.insert("file", "./GAMS/trnsport.gms");
+    history << entry;
+    Settings::settings()->setList(skHistory, history);
+    Settings::settings()->save();
+    Settings::releaseSettings();
+
+    // the snapshot keys aren't written to the JSON file
+    QFile json("./GAMS/studio.json");
+    Q_ASSERT(json.open(QFile::ReadOnly));
+    Q_ASSERT(!json.readAll().contains("\"history\""));
+    json.close();
+    Q_ASSERT(QFile::exists("./GAMS/studio.snapshot"));
+
+    // create and read settings, compare value
+    Settings::createSettings(false, false, false);
+    QVariantList stored = Settings::settings()->toList(skHistory);
+    QCOMPARE(stored.size(), 1);
+    QCOMPARE(stored.first().toMap().value("file").toString(), QString("./GAMS/trnsport.gms"));
+    Settings::releaseSettings();
+}
+
 QTEST_MAIN(TestSettings)
@@ -43,6 +43,8 @@ private slots:
     void testWriteSettingsReset();
 
     void testIgnoreIfNoFilesExist();
+
+    void testSnapshotKeys();
 };
 
 #endif // TESTSETTINGS_H
@@ -22,10 +22,13 @@ TEMPLATE = app
 
 include(../tests.pri)
 
+QT += concurrent
+
 INCLUDEPATH += $$SRCPATH
 
 HEADERS += \
     testsettings.h \
+    $$SRCPATH/settingssnapshot.h \
     $$SRCPATH/file/dynamicfile.h \
     $$SRCPATH/scheme.h \
     $$SRCPATH/svgengine.h \
@@ -37,6 +40,7 @@ HEADERS += \
 SOURCES += \
     testsettings.cpp \
     $$SRCPATH/settings.cpp \
+    $$SRCPATH/settingssnapshot.cpp \
     $$SRCPATH/commonpaths.cpp \
     $$SRCPATH/logger.cpp \
     $$SRCPATH/exception.cpp \
@@ -0,0 +1,101 @@
+/*
+ * This file is part of the GAMS Studio project.
+ *
+ * Copyright (c) 2017-2020 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2020 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "testsyntaxhighlighter.h"
+#include "syntax/syntaxhighlighter.h"
+
+#include <QCoreApplication>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QTextDocument>
+
+using gams::studio::syntax::SyntaxHighlighter;
+
+// Set GAMSSTUDIO_MODLIB to a directory with .gms files (e.g. an extracted model library) to benchmark them too.
+void TestSyntaxHighlighter::benchmarkHighlight_data()
+{
+    QTest::addColumn<QString>("source");
+
+    QTest::newRow("generated") << generatedModel(200);
+    QDir modLib(qEnvironmentVariable("GAMSSTUDIO_MODLIB"));
+    if (modLib.path().isEmpty() || modLib.path() == "." || !modLib.exists())
+        return;
+    for (const QFileInfo &info: modLib.entryInfoList(QStringList() << "*.gms", QDir::Files, QDir::Name)) {
+        QFile file(info.filePath());
+        if (file.open(QFile::ReadOnly | QFile::Text))
+            QTest::newRow(info.fileName().toLatin1()) << QString::fromLatin1(file.readAll());
+    }
+}
+
+void TestSyntaxHighlighter::benchmarkHighlight()
+{
+    QFETCH(QString, source);
+    QTextDocument doc;
+    doc.setPlainText(source);
+    SyntaxHighlighter highlighter(&doc);
+
+    qint64 nsecs = 0;
+    int runs = 0;
+    QBENCHMARK {
+        QElapsedTimer timer;
+        timer.start();
+        highlighter.rehighlight();
+        // the highlighter continues in slices of 50ms from the event loop
+        while (highlighter.hasDirtyBlocks())
+            QCoreApplication::processEvents();
+        nsecs += timer.nsecsElapsed();
+        ++runs;
+    }
+    if (nsecs > 0)
+        qInfo("%.0f lines per second", double(doc.blockCount()) * runs * 1e9 / nsecs);
+}
+
+QString TestSyntaxHighlighter::generatedModel(int copies)
+{
+    QString part =
+            "$title generated benchmark model\n"
+            "* comment line\n"
+            "Set i 'canning plants' / seattle, san-diego /\n"
+            "    j 'markets'        / new-york, chicago, topeka /;\n"
+            "Parameter a(i) 'capacity' / seattle 350, san-diego 600 /;\n"
+            "Table d(i,j) 'distance in thousands of miles'\n"
+            "              new-york  chicago  topeka\n"
+            "   seattle         2.5      1.7     1.8\n"
+            "   san-diego       2.5      1.8     1.4;\n"
+            "Scalar f 'freight' / 90 /;\n"
+            "Variable x(i,j), z;\n"
+            "Positive Variable x;\n"
+            "Equation cost, supply(i);\n"
+            "cost..      z =e= sum((i,j), f*d(i,j)*x(i,j)/1000);  !! end of line comment\n"
+            "supply(i).. sum(j, x(i,j)) =l= a(i);\n"
+            "$onText\n"
+            "block comment\n"
+            "$offText\n"
+            "Model transport / all /;\n"
+            "option lp = cplex;\n"
+            "solve transport using lp minimizing z;\n"
+            "display x.l, x.m;\n";
+    QString res;
+    res.reserve(part.length() * copies);
+    for (int i = 0; i < copies; ++i)
+        res += part;
+    return res;
+}
+
+QTEST_MAIN(TestSyntaxHighlighter)
@@ -0,0 +1,54 @@
+#
+# This file is part of the GAMS Studio project.
+#
+# Copyright (c) 2017-2020 GAMS Software GmbH <support@gams.com>
+# Copyright (c) 2017-2020 GAMS Development Corp. <support@gams.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program. If not, see <http://www.gnu.org/licenses/>.
+#
+
+TEMPLATE = app
+
+include(../tests.pri)
+
+INCLUDEPATH += $$SRCPATH \
+               $$SRCPATH/syntax
+
+HEADERS += \
+    $$SRCPATH/diagnostics.h \
+    testsyntaxhighlighter.h \
+    $$SRCPATH/syntax/basehighlighter.h \
+    $$SRCPATH/syntax/blockdata.h \
+    $$SRCPATH/syntax/syntaxdeclaration.h \
+    $$SRCPATH/syntax/syntaxformats.h \
+    $$SRCPATH/syntax/syntaxhighlighter.h \
+    $$SRCPATH/syntax/syntaxidentifier.h \
+    $$SRCPATH/svgengine.h \
+    $$SRCPATH/scheme.h
+
+SOURCES += \
+    testsyntaxhighlighter.cpp \
+    $$SRCPATH/syntax/basehighlighter.cpp \
+    $$SRCPATH/syntax/blockdata.cpp \
+    $$SRCPATH/syntax/syntaxdeclaration.cpp \
+    $$SRCPATH/syntax/syntaxformats.cpp \
+    $$SRCPATH/syntax/syntaxhighlighter.cpp \
+    $$SRCPATH/syntax/syntaxidentifier.cpp \
+    $$SRCPATH/diagnostics.cpp \
+    $$SRCPATH/editors/defaultsystemlogger.cpp \
+    $$SRCPATH/editors/sysloglocator.cpp \
+    $$SRCPATH/exception.cpp \
+    $$SRCPATH/logger.cpp \
+    $$SRCPATH/svgengine.cpp \
+    $$SRCPATH/scheme.cpp
@@ -157,4 +157,33 @@ void testmainwindow::test_search()
     QCOMPARE(sd->results()->size(), 2);
 }
 
+void testmainwindow::bench_restoreTabs()
+{
+    // restoring a session only creates the editor of the current tab, the others follow in the background
+    QStringList copies;
+    QVariantList tabs;
+    for (int i = 0; i < 80; ++i) {
+        QString copy = mGms.path() + QString("/trnsport_tab%1.gms").arg(i);
+        if (!QFile::exists(copy)) QFile::copy(mGms.filePath(), copy);
+        copies << copy;
+        QVariantMap tab;
+        tab.insert("location", copy);
+        tabs << tab;
+    }
+    QVariantMap tabData;
+    tabData.insert("mainTabs", tabs);
+    tabData.insert("mainTabRecent", mGms.filePath());
+
+    QBENCHMARK_ONCE {
+        QVERIFY(mMainWindow->readTabs(tabData));
+    }
+    QVERIFY2(mMainWindow->recent()->editor(), "No editor for the current tab.");
+    QVERIFY2(mMainWindow->recent()->editor()->property("location").toString() == mGms.filePath(),
+             "Wrong file focussed. Expected: trnsport.gms");
+
+    QMetaObject::invokeMethod(mMainWindow, "on_actionClose_All_triggered");
+    for (const QString &copy : copies)
+        QFile::remove(copy);
+}
+
 QTEST_MAIN(testmainwindow)
@@ -37,6 +37,7 @@ private Q_SLOTS:
 
     void test_gdxValue();
     void test_search();
+    void bench_restoreTabs();
 
 private:
     MainWindow* mMainWindow = nullptr;
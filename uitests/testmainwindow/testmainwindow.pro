@@ -34,10 +34,13 @@ HEADERS += $$files(*.h, true) \
            $$SRCPATH/common.h \
            $$SRCPATH/commonpaths.h \
            $$SRCPATH/support/distributionvalidator.h \
+           $$SRCPATH/diagnostics.h \
            $$SRCPATH/exception.h \
            $$SRCPATH/file.h \
            $$SRCPATH/file/dynamicfile.h \
+    $$SRCPATH/file/filechangewatcher.h \
            $$SRCPATH/file/fileevent.h \
+           $$SRCPATH/file/includegraph.h \
            $$SRCPATH/file/filemeta.h \
            $$SRCPATH/file/filemetarepo.h \
            $$SRCPATH/file/filetype.h \
@@ -58,23 +61,28 @@ HEADERS += $$files(*.h, true) \
            $$SRCPATH/gdxviewer/columnfilter.h \
            $$SRCPATH/gdxviewer/columnfilterframe.h \
            $$SRCPATH/gdxviewer/filteruelmodel.h \
+           $$SRCPATH/gdxviewer/gdxdatastore.h \
            $$SRCPATH/gdxviewer/gdxsymbol.h \
            $$SRCPATH/gdxviewer/gdxsymbolheaderview.h \
            $$SRCPATH/gdxviewer/gdxsymboltable.h \
            $$SRCPATH/gdxviewer/gdxsymbolview.h \
            $$SRCPATH/gdxviewer/gdxviewer.h \
            $$SRCPATH/gdxviewer/nestedheaderview.h \
+           $$SRCPATH/gdxviewer/selectionexport.h \
+           $$SRCPATH/gdxviewer/symbolstatistics.h \
            $$SRCPATH/gdxviewer/tableviewmodel.h \
+           $$SRCPATH/gdxviewer/uelindex.h \
            $$SRCPATH/keys.h \
            $$SRCPATH/locators/searchlocator.h \
            $$SRCPATH/logger.h \
            $$SRCPATH/lxiviewer/lxiparser.h \
-           $$SRCPATH/lxiviewer/lxitreeitem.h \
            $$SRCPATH/lxiviewer/lxitreemodel.h \
            $$SRCPATH/lxiviewer/lxiviewer.h \
            $$SRCPATH/mainwindow.h \
            $$SRCPATH/modeldialog/glbparser.h \
            $$SRCPATH/modeldialog/library.h \
+           $$SRCPATH/modeldialog/librarycache.h \
+           $$SRCPATH/modeldialog/libraryfiltermodel.h \
            $$SRCPATH/modeldialog/libraryitem.h \
            $$SRCPATH/modeldialog/librarymodel.h \
            $$SRCPATH/modeldialog/modeldialog.h \
@@ -92,6 +100,7 @@ HEADERS += $$files(*.h, true) \
            $$SRCPATH/option/optiontokenizer.h \
            $$SRCPATH/option/optionwidget.h \
            $$SRCPATH/option/solveroptiondefinitionmodel.h \
+           $$SRCPATH/option/solveroptionloader.h \
            $$SRCPATH/option/solveroptiontablemodel.h \
            $$SRCPATH/option/solveroptionwidget.h \
            $$SRCPATH/reference/reference.h \
@@ -115,6 +124,7 @@ HEADERS += $$files(*.h, true) \
            $$SRCPATH/syntax.h \
            $$SRCPATH/syntax/basehighlighter.h \
            $$SRCPATH/syntax/blockcode.h \
+           $$SRCPATH/syntax/symbolindex.h \
            $$SRCPATH/syntax/syntaxdeclaration.h \
            $$SRCPATH/syntax/syntaxformats.h \
            $$SRCPATH/syntax/syntaxhighlighter.h \
@@ -161,9 +171,12 @@ SOURCES += $$files(*.cpp, true) \
            $$SRCPATH/commandlineparser.cpp \
            $$SRCPATH/commonpaths.cpp \
            $$SRCPATH/support/distributionvalidator.cpp \
+           $$SRCPATH/diagnostics.cpp \
            $$SRCPATH/exception.cpp \
            $$SRCPATH/file/dynamicfile.cpp \
+    $$SRCPATH/file/filechangewatcher.cpp \
            $$SRCPATH/file/fileevent.cpp \
+           $$SRCPATH/file/includegraph.cpp \
            $$SRCPATH/file/filemeta.cpp \
            $$SRCPATH/file/filemetarepo.cpp \
            $$SRCPATH/file/filetype.cpp \
@@ -184,23 +197,28 @@ SOURCES += $$files(*.cpp, true) \
            $$SRCPATH/gdxviewer/columnfilter.cpp \
            $$SRCPATH/gdxviewer/columnfilterframe.cpp \
            $$SRCPATH/gdxviewer/filteruelmodel.cpp \
+           $$SRCPATH/gdxviewer/gdxdatastore.cpp \
            $$SRCPATH/gdxviewer/gdxsymbol.cpp \
            $$SRCPATH/gdxviewer/gdxsymbolheaderview.cpp \
            $$SRCPATH/gdxviewer/gdxsymboltable.cpp \
            $$SRCPATH/gdxviewer/gdxsymbolview.cpp \
            $$SRCPATH/gdxviewer/gdxviewer.cpp \
            $$SRCPATH/gdxviewer/nestedheaderview.cpp \
+           $$SRCPATH/gdxviewer/selectionexport.cpp \
+           $$SRCPATH/gdxviewer/symbolstatistics.cpp \
            $$SRCPATH/gdxviewer/tableviewmodel.cpp \
+           $$SRCPATH/gdxviewer/uelindex.cpp \
            $$SRCPATH/keys.cpp \
            $$SRCPATH/locators/searchlocator.cpp \
            $$SRCPATH/logger.cpp \
            $$SRCPATH/lxiviewer/lxiparser.cpp \
-           $$SRCPATH/lxiviewer/lxitreeitem.cpp \
            $$SRCPATH/lxiviewer/lxitreemodel.cpp \
            $$SRCPATH/lxiviewer/lxiviewer.cpp \
            $$SRCPATH/mainwindow.cpp \
            $$SRCPATH/modeldialog/glbparser.cpp   \
            $$SRCPATH/modeldialog/library.cpp     \
+           $$SRCPATH/modeldialog/librarycache.cpp \
+           $$SRCPATH/modeldialog/libraryfiltermodel.cpp \
            $$SRCPATH/modeldialog/libraryitem.cpp \
            $$SRCPATH/modeldialog/librarymodel.cpp \
            $$SRCPATH/modeldialog/modeldialog.cpp \
@@ -218,6 +236,7 @@ SOURCES += $$files(*.cpp, true) \
            $$SRCPATH/option/optiontokenizer.cpp \
            $$SRCPATH/option/optionwidget.cpp \
            $$SRCPATH/option/solveroptiondefinitionmodel.cpp \
+           $$SRCPATH/option/solveroptionloader.cpp \
            $$SRCPATH/option/solveroptiontablemodel.cpp \
            $$SRCPATH/option/solveroptionwidget.cpp \
            $$SRCPATH/reference/reference.cpp \
@@ -239,6 +258,7 @@ SOURCES += $$files(*.cpp, true) \
            $$SRCPATH/studiosettings.cpp \
            $$SRCPATH/support/solverconfiginfo.cpp \
            $$SRCPATH/syntax/basehighlighter.cpp \
+           $$SRCPATH/syntax/symbolindex.cpp \
            $$SRCPATH/syntax/syntaxdeclaration.cpp \
            $$SRCPATH/syntax/syntaxformats.cpp \
            $$SRCPATH/syntax/syntaxhighlighter.cpp \